@@ -0,0 +1,81 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CharacterVariants/AbilityInputs.h"
+#include "HAL/IConsoleManager.h"
+#include "MoverDataModelTypes.h"
+#include "MoverLog.h"
+#include "UObject/CoreNet.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AbilityInputs)
+
+const FMoverExampleAbilityInputs& FMoverExampleAbilityInputs::FindOrDefault(const FMoverDataCollection& Collection)
+{
+	if (const FMoverExampleAbilityInputs* FoundInputs = Collection.FindDataByType<FMoverExampleAbilityInputs>())
+	{
+		return *FoundInputs;
+	}
+
+	static const FMoverExampleAbilityInputs DefaultInputs;
+	return DefaultInputs;
+}
+
+
+#if !UE_BUILD_SHIPPING
+namespace AbilityInputs::Utils::Private
+{
+	// Usage: MoverExamples.AbilityInputs.BenchmarkSparseInputs [NumFrames]
+	// Copies, serializes and compares an idle character's input collection each frame, as input history and rollback
+	// do, with and without default ability inputs in it
+	static void BenchmarkSparseInputs(const TArray<FString>& Args)
+	{
+		const int32 NumFrames = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 100000;
+
+		auto RunFrames = [NumFrames](bool bIncludeAbilityInputs, int64& OutBits, int32& OutNumReconciles)
+		{
+			FMoverDataCollection Collection;
+			Collection.FindOrAddMutableDataByType<FCharacterDefaultInputs>();
+			if (bIncludeAbilityInputs)
+			{
+				Collection.FindOrAddMutableDataByType<FMoverExampleAbilityInputs>();
+			}
+
+			OutBits = 0;
+			OutNumReconciles = 0;
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+			{
+				FMoverDataCollection HistoryCopy;
+				HistoryCopy = Collection;
+
+				FNetBitWriter Writer(nullptr, 256);
+				bool bSuccess = false;
+				HistoryCopy.NetSerialize(Writer, nullptr, bSuccess);
+				OutBits += Writer.GetNumBits();
+
+				OutNumReconciles += HistoryCopy.ShouldReconcile(Collection) ? 1 : 0;
+			}
+			const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+			OutBits /= NumFrames;
+			return ElapsedMs;
+		};
+
+		int64 FullBits = 0;
+		int64 SparseBits = 0;
+		int32 NumReconciles = 0;
+		int32 Checksum = 0;
+		const double FullMs = RunFrames(true, FullBits, NumReconciles);
+		Checksum += NumReconciles;
+		const double SparseMs = RunFrames(false, SparseBits, NumReconciles);
+		Checksum += NumReconciles;
+
+		UE_LOG(LogMover, Display, TEXT("Ability inputs, %d idle frames | included %lld bits/cmd, %.3f us/frame | omitted %lld bits/cmd, %.3f us/frame (checksum %d)"),
+			NumFrames, FullBits, FullMs * 1000.0 / NumFrames, SparseBits, SparseMs * 1000.0 / NumFrames, Checksum);
+	}
+
+	static FAutoConsoleCommand BenchmarkSparseInputsCmd(
+		TEXT("MoverExamples.AbilityInputs.BenchmarkSparseInputs"),
+		TEXT("Compares input command size and per-frame copy, serialize and reconcile time with and without default ability inputs. Optional arg: number of frames."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkSparseInputs));
+}
+#endif // !UE_BUILD_SHIPPING
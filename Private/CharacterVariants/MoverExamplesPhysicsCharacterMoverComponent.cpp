@@ -6,16 +6,15 @@
 
 void UMoverExamplesPhysicsCharacterMoverComponent::OnMoverPreMovement(const FMoverTimeStep& TimeStep, const FMoverInputCmdContext& InputCmd, const FMoverSyncState& SyncState, const FMoverAuxStateContext& AuxState)
 {
-	if (FMoverExampleAbilityInputs* AbilityInputs = InputCmd.InputCollection.FindMutableDataByType<FMoverExampleAbilityInputs>())
+	// Missing ability inputs mean no buttons are pressed, so that uncrouches too
+	const FMoverExampleAbilityInputs& AbilityInputs = FMoverExampleAbilityInputs::FindOrDefault(InputCmd.InputCollection);
+	if (AbilityInputs.WantsToBeCrouched())
 	{
-		if (AbilityInputs->bWantsToBeCrouched)
-		{
-			Crouch_Internal(SyncState);
-		}
-		else
-		{
-			UnCrouch_Internal(SyncState);
-		}
+		Crouch_Internal(SyncState);
+	}
+	else
+	{
+		UnCrouch_Internal(SyncState);
 	}
 
 	Super::OnMoverPreMovement(TimeStep, InputCmd, SyncState, AuxState);
@@ -0,0 +1,115 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CharacterVariants/Ziplining/ZiplineCurve.h"
+
+
+namespace ZiplineCurve::Utils::Private
+{
+	static constexpr int32 MaxSpans = 256;
+	static constexpr int32 SubstepsPerSpan = 8;
+
+	static FVector EvaluateParabola(const FVector& A, const FVector& B, float SagDepth, float U)
+	{
+		return FMath::Lerp(A, B, U) - (FVector::UpVector * (SagDepth * 4.0f * U * (1.0f - U)));
+	}
+}
+
+void FZiplineCurve::Build(const FVector& A, const FVector& B, float InSagDepth, float Tolerance)
+{
+	using namespace ZiplineCurve::Utils::Private;
+
+	EndpointA = A;
+	EndpointB = B;
+	SagDepth = FMath::Max(InSagDepth, 0.0f);
+
+	// A chord spanning H of the parameter strays at most SagDepth * H^2 from the parabola
+	const int32 NumSpans = (SagDepth > UE_KINDA_SMALL_NUMBER) ? FMath::Clamp(FMath::CeilToInt32(FMath::Sqrt(SagDepth / FMath::Max(Tolerance, UE_KINDA_SMALL_NUMBER))), 1, MaxSpans) : 1;
+
+	if (NumSpans == 1)
+	{
+		Points = { A, B };
+		Length = FVector::Dist(A, B);
+		return;
+	}
+
+	// Measure the arc length finely, then place the points at even distances along it
+	const int32 NumSubsteps = NumSpans * SubstepsPerSpan;
+	TArray<float, TInlineAllocator<MaxSpans * SubstepsPerSpan + 1>> Distances;
+	Distances.SetNumUninitialized(NumSubsteps + 1);
+	Distances[0] = 0.0f;
+
+	FVector PrevPoint = A;
+	for (int32 Step = 1; Step <= NumSubsteps; ++Step)
+	{
+		const FVector Point = EvaluateParabola(A, B, SagDepth, float(Step) / NumSubsteps);
+		Distances[Step] = Distances[Step - 1] + FVector::Dist(PrevPoint, Point);
+		PrevPoint = Point;
+	}
+
+	Length = Distances.Last();
+
+	Points.SetNumUninitialized(NumSpans + 1);
+	Points[0] = A;
+	Points[NumSpans] = B;
+
+	int32 Step = 1;
+	for (int32 PointIdx = 1; PointIdx < NumSpans; ++PointIdx)
+	{
+		const float TargetDistance = Length * PointIdx / NumSpans;
+		while (Distances[Step] < TargetDistance)
+		{
+			++Step;
+		}
+
+		const float StepAlpha = (TargetDistance - Distances[Step - 1]) / FMath::Max(Distances[Step] - Distances[Step - 1], UE_SMALL_NUMBER);
+		Points[PointIdx] = EvaluateParabola(A, B, SagDepth, (Step - 1 + StepAlpha) / NumSubsteps);
+	}
+}
+
+bool FZiplineCurve::IsBuiltFrom(const FVector& A, const FVector& B, float InSagDepth) const
+{
+	return EndpointA.Equals(A) && EndpointB.Equals(B) && FMath::IsNearlyEqual(SagDepth, FMath::Max(InSagDepth, 0.0f));
+}
+
+int32 FZiplineCurve::GetSpan(float Progress, float& OutAlpha) const
+{
+	const float SpanPos = FMath::Clamp(Progress, 0.0f, 1.0f) * NumSpans();
+	const int32 Span = FMath::Min(static_cast<int32>(SpanPos), NumSpans() - 1);
+	OutAlpha = SpanPos - Span;
+	return Span;
+}
+
+FVector FZiplineCurve::GetLocationAtProgress(float Progress) const
+{
+	float Alpha;
+	const int32 Span = GetSpan(Progress, Alpha);
+	return FMath::Lerp(Points[Span], Points[Span + 1], Alpha);
+}
+
+FVector FZiplineCurve::GetDirectionAtProgress(float Progress) const
+{
+	float Alpha;
+	const int32 Span = GetSpan(Progress, Alpha);
+	return (Points[Span + 1] - Points[Span]).GetSafeNormal();
+}
+
+float FZiplineCurve::GetProgressOnSpan(int32 SpanIndex, const FVector& Point) const
+{
+	const FVector SpanStart = Points[SpanIndex];
+	const FVector SpanEnd = Points[SpanIndex + 1];
+	const float SpanLengthSq = FVector::DistSquared(SpanStart, SpanEnd);
+	const float Alpha = (SpanLengthSq > UE_SMALL_NUMBER) ? FMath::Clamp(((Point - SpanStart) | (SpanEnd - SpanStart)) / SpanLengthSq, 0.0f, 1.0f) : 0.0f;
+	return (SpanIndex + Alpha) / NumSpans();
+}
+
+float FZiplineCurve::ComputeSagDepthForCableLength(const FVector& A, const FVector& B, float CableLength)
+{
+	// Arc length of a shallow parabola of span D and sag S is about D + 8S^2 / 3D
+	const float Span = FVector::Dist(A, B);
+	if (CableLength <= Span || Span <= UE_KINDA_SMALL_NUMBER)
+	{
+		return 0.0f;
+	}
+
+	return FMath::Sqrt(3.0f * Span * (CableLength - Span) / 8.0f);
+}
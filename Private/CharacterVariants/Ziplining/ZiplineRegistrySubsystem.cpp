@@ -0,0 +1,579 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CharacterVariants/Ziplining/ZiplineRegistrySubsystem.h"
+#include "CharacterVariants/Ziplining/ZiplineInterface.h"
+#include "CableComponent.h"
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "MoverLog.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ZiplineRegistrySubsystem)
+
+
+// FZiplineSpatialGrid //////////////////////////////
+
+FZiplineSpatialGrid::FZiplineSpatialGrid(float InCellSize)
+	: CellSize(FMath::Max(InCellSize, 1.0f))
+	, InvCellSize(1.0f / CellSize)
+{
+}
+
+void FZiplineSpatialGrid::Reset()
+{
+	Segments.Reset();
+	FreeSegments.Reset();
+	Cells.Reset();
+}
+
+FIntVector FZiplineSpatialGrid::GetCell(const FVector& Location) const
+{
+	return FIntVector(
+		FMath::FloorToInt32(Location.X * InvCellSize),
+		FMath::FloorToInt32(Location.Y * InvCellSize),
+		FMath::FloorToInt32(Location.Z * InvCellSize));
+}
+
+template<typename FuncType>
+void FZiplineSpatialGrid::ForEachCellOnSegment(const FVector& Start, const FVector& End, FuncType&& Func) const
+{
+	// Sample at half cell intervals. A straight line visits cells in order, so skipping repeats of the last cell is enough
+	// to visit each once. Cells only clipped between two samples are covered by the query padding in FindNearestSegment.
+	const int32 NumSteps = FMath::Max(1, FMath::CeilToInt32(FVector::Dist(Start, End) * InvCellSize * 2.0f));
+
+	FIntVector LastCell = GetCell(Start);
+	Func(LastCell);
+
+	for (int32 Step = 1; Step <= NumSteps; ++Step)
+	{
+		const FIntVector Cell = GetCell(FMath::Lerp(Start, End, float(Step) / float(NumSteps)));
+		if (Cell != LastCell)
+		{
+			Func(Cell);
+			LastCell = Cell;
+		}
+	}
+}
+
+int32 FZiplineSpatialGrid::AddSegment(const FVector& Start, const FVector& End)
+{
+	const int32 SegmentIndex = FreeSegments.Num() > 0 ? FreeSegments.Pop(EAllowShrinking::No) : Segments.AddDefaulted();
+
+	FSegment& Segment = Segments[SegmentIndex];
+	Segment.Start = Start;
+	Segment.End = End;
+	Segment.bIsValid = true;
+
+	ForEachCellOnSegment(Start, End, [this, SegmentIndex](const FIntVector& Cell)
+	{
+		Cells.FindOrAdd(Cell).Add(SegmentIndex);
+	});
+
+	return SegmentIndex;
+}
+
+void FZiplineSpatialGrid::RemoveSegment(int32 SegmentIndex)
+{
+	if (!Segments.IsValidIndex(SegmentIndex) || !Segments[SegmentIndex].bIsValid)
+	{
+		return;
+	}
+
+	FSegment& Segment = Segments[SegmentIndex];
+
+	ForEachCellOnSegment(Segment.Start, Segment.End, [this, SegmentIndex](const FIntVector& Cell)
+	{
+		if (TArray<int32, TInlineAllocator<4>>* CellSegments = Cells.Find(Cell))
+		{
+			CellSegments->RemoveSingleSwap(SegmentIndex, EAllowShrinking::No);
+			if (CellSegments->IsEmpty())
+			{
+				Cells.Remove(Cell);
+			}
+		}
+	});
+
+	Segment.bIsValid = false;
+	FreeSegments.Add(SegmentIndex);
+}
+
+bool FZiplineSpatialGrid::FindNearestSegment(const FVector& Point, float Radius, int32& OutSegmentIndex, FVector& OutClosestPoint) const
+{
+	OutSegmentIndex = INDEX_NONE;
+
+	// Pad by the largest gap between a segment and the cells it was registered in (a quarter cell, see ForEachCellOnSegment)
+	const FVector Padding(Radius + (CellSize * 0.25f));
+	const FIntVector MinCell = GetCell(Point - Padding);
+	const FIntVector MaxCell = GetCell(Point + Padding);
+
+	float BestDistSq = FMath::Square(Radius);
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+			{
+				const TArray<int32, TInlineAllocator<4>>* CellSegments = Cells.Find(FIntVector(X, Y, Z));
+				if (!CellSegments)
+				{
+					continue;
+				}
+
+				// Segments spanning several cells get tested more than once, which is cheaper than tracking visits
+				for (const int32 SegmentIndex : *CellSegments)
+				{
+					const FSegment& Segment = Segments[SegmentIndex];
+					const FVector ClosestPoint = FMath::ClosestPointOnSegment(Point, Segment.Start, Segment.End);
+					const float DistSq = FVector::DistSquared(Point, ClosestPoint);
+
+					if (DistSq <= BestDistSq)
+					{
+						BestDistSq = DistSq;
+						OutSegmentIndex = SegmentIndex;
+						OutClosestPoint = ClosestPoint;
+					}
+				}
+			}
+		}
+	}
+
+	return OutSegmentIndex != INDEX_NONE;
+}
+
+
+
+// UZiplineRegistrySubsystem //////////////////////////////
+
+void UZiplineRegistrySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	UWorld* World = GetWorld();
+	ActorSpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &UZiplineRegistrySubsystem::OnActorSpawned));
+	ActorDestroyedHandle = World->AddOnActorDestroyedHandler(FOnActorDestroyed::FDelegate::CreateUObject(this, &UZiplineRegistrySubsystem::OnActorDestroyed));
+}
+
+void UZiplineRegistrySubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+		World->RemoveOnActorDestroyedHandler(ActorDestroyedHandle);
+	}
+
+	Grid.Reset();
+	SegmentOwners.Reset();
+	Ziplines.Reset();
+	NetIdZiplines.Reset();
+	DynamicZiplines.Reset();
+
+	Super::Deinitialize();
+}
+
+void UZiplineRegistrySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	bIsRegisteringLevelZiplines = true;
+	for (TActorIterator<AActor> It(&InWorld); It; ++It)
+	{
+		if (It->Implements<UZipline>())
+		{
+			RegisterZipline(*It);
+		}
+	}
+	bIsRegisteringLevelZiplines = false;
+
+	RebuildJunctions();
+}
+
+void UZiplineRegistrySubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// Registering again only rebuilds a zipline that actually moved. Copied, since a rebuild re-adds the zipline.
+	const TArray<TWeakObjectPtr<AActor>> ZiplinesToRefresh = DynamicZiplines;
+	for (const TWeakObjectPtr<AActor>& ZiplineActor : ZiplinesToRefresh)
+	{
+		RegisterZipline(ZiplineActor.Get());
+	}
+}
+
+TStatId UZiplineRegistrySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UZiplineRegistrySubsystem, STATGROUP_Tickables);
+}
+
+void UZiplineRegistrySubsystem::OnActorSpawned(AActor* SpawnedActor)
+{
+	if (SpawnedActor && SpawnedActor->Implements<UZipline>())
+	{
+		RegisterZipline(SpawnedActor);
+	}
+}
+
+void UZiplineRegistrySubsystem::OnActorDestroyed(AActor* DestroyedActor)
+{
+	UnregisterZipline(DestroyedActor);
+}
+
+float UZiplineRegistrySubsystem::GetZiplineSagDepth(AActor* ZiplineActor, const FVector& ZipLocA, const FVector& ZipLocB)
+{
+	const float SagDepth = IZipline::Execute_GetSagDepth(ZiplineActor);
+	if (SagDepth >= 0.0f)
+	{
+		return SagDepth;
+	}
+
+	if (const UCableComponent* Cable = ZiplineActor->FindComponentByClass<UCableComponent>())
+	{
+		return FZiplineCurve::ComputeSagDepthForCableLength(ZipLocA, ZipLocB, Cable->CableLength);
+	}
+
+	return 0.0f;
+}
+
+void UZiplineRegistrySubsystem::RegisterZipline(AActor* ZiplineActor)
+{
+	if (!ZiplineActor || !ZiplineActor->Implements<UZipline>())
+	{
+		return;
+	}
+
+	USceneComponent* ZipPointA = IZipline::Execute_GetStartComponent(ZiplineActor);
+	USceneComponent* ZipPointB = IZipline::Execute_GetEndComponent(ZiplineActor);
+	if (!ZipPointA || !ZipPointB)
+	{
+		UE_LOG(LogMover, Warning, TEXT("Zipline %s has no start or end component and won't be grabbable"), *GetNameSafe(ZiplineActor));
+		return;
+	}
+
+	const FVector ZipLocA = ZipPointA->GetComponentLocation();
+	const FVector ZipLocB = ZipPointB->GetComponentLocation();
+	const float SagDepth = GetZiplineSagDepth(ZiplineActor, ZipLocA, ZipLocB);
+
+	if (const FRegisteredZipline* Existing = Ziplines.Find(ZiplineActor))
+	{
+		if (Existing->Curve->IsBuiltFrom(ZipLocA, ZipLocB, SagDepth))
+		{
+			return;
+		}
+	}
+
+	// Junctions are rebuilt once below, for the old and new curve together
+	RemoveZipline(ZiplineActor);
+
+	TSharedPtr<FZiplineCurve, ESPMode::ThreadSafe> Curve = MakeShared<FZiplineCurve, ESPMode::ThreadSafe>();
+	Curve->Build(ZipLocA, ZipLocB, SagDepth);
+
+	FRegisteredZipline& Registered = Ziplines.Add(ZiplineActor);
+	Registered.Curve = Curve;
+	Registered.bIsDynamic = IZipline::Execute_IsDynamic(ZiplineActor);
+
+	if (Registered.bIsDynamic)
+	{
+		DynamicZiplines.Add(ZiplineActor);
+	}
+
+	for (AActor* ConnectedZipline : IZipline::Execute_GetConnectedZiplines(ZiplineActor))
+	{
+		Registered.ConnectedZiplines.Add(ConnectedZipline);
+	}
+
+	const uint32 NetId = ComputeZiplineNetId(ZiplineActor);
+	if (NetId != InvalidNetId)
+	{
+		if (const TWeakObjectPtr<AActor>* Existing = NetIdZiplines.Find(NetId))
+		{
+			// Which one keeps the id would depend on registration order, which machines don't share. Rename one of them.
+			UE_LOG(LogMover, Error, TEXT("Zipline %s has the same net id as %s, riders of it won't replicate correctly"), *GetNameSafe(ZiplineActor), *GetNameSafe(Existing->Get()));
+		}
+		else
+		{
+			NetIdZiplines.Add(NetId, ZiplineActor);
+			Registered.NetId = NetId;
+		}
+	}
+
+	for (int32 SpanIndex = 0; SpanIndex < Curve->NumSpans(); ++SpanIndex)
+	{
+		const int32 SegmentIndex = Grid.AddSegment(Curve->Points[SpanIndex], Curve->Points[SpanIndex + 1]);
+		if (SegmentIndex >= SegmentOwners.Num())
+		{
+			SegmentOwners.SetNum(SegmentIndex + 1);
+		}
+
+		SegmentOwners[SegmentIndex].ZiplineActor = ZiplineActor;
+		SegmentOwners[SegmentIndex].SpanIndex = SpanIndex;
+		Registered.GridSegments.Add(SegmentIndex);
+	}
+
+	if (!bIsRegisteringLevelZiplines)
+	{
+		RebuildJunctions();
+	}
+}
+
+void UZiplineRegistrySubsystem::UnregisterZipline(AActor* ZiplineActor)
+{
+	if (RemoveZipline(ZiplineActor) && !bIsRegisteringLevelZiplines)
+	{
+		RebuildJunctions();
+	}
+}
+
+bool UZiplineRegistrySubsystem::RemoveZipline(AActor* ZiplineActor)
+{
+	FRegisteredZipline Registered;
+	if (!Ziplines.RemoveAndCopyValue(ZiplineActor, Registered))
+	{
+		return false;
+	}
+
+	if (Registered.NetId != InvalidNetId)
+	{
+		NetIdZiplines.Remove(Registered.NetId);
+	}
+
+	if (Registered.bIsDynamic)
+	{
+		DynamicZiplines.RemoveSwap(ZiplineActor);
+	}
+
+	for (const int32 SegmentIndex : Registered.GridSegments)
+	{
+		Grid.RemoveSegment(SegmentIndex);
+		SegmentOwners[SegmentIndex] = FGridSegmentOwner();
+	}
+
+	return !Registered.ConnectedZiplines.IsEmpty();
+}
+
+void UZiplineRegistrySubsystem::RebuildJunctions()
+{
+	for (TPair<TObjectKey<AActor>, FRegisteredZipline>& Pair : Ziplines)
+	{
+		Pair.Value.Junctions[0] = FZiplineJunction();
+		Pair.Value.Junctions[1] = FZiplineJunction();
+	}
+
+	for (TPair<TObjectKey<AActor>, FRegisteredZipline>& Pair : Ziplines)
+	{
+		AActor* ZiplineActor = Pair.Key.ResolveObjectPtr();
+		for (const TWeakObjectPtr<AActor>& ConnectedZipline : Pair.Value.ConnectedZiplines)
+		{
+			ConnectZiplines(ZiplineActor, ConnectedZipline.Get());
+		}
+	}
+}
+
+void UZiplineRegistrySubsystem::ConnectZiplines(AActor* ZiplineActor, AActor* OtherZipline)
+{
+	FRegisteredZipline* Registered = ZiplineActor ? Ziplines.Find(ZiplineActor) : nullptr;
+	FRegisteredZipline* OtherRegistered = (OtherZipline && OtherZipline != ZiplineActor) ? Ziplines.Find(OtherZipline) : nullptr;
+	if (!Registered || !OtherRegistered)
+	{
+		return;
+	}
+
+	const FZiplineCurve& Curve = *Registered->Curve;
+	const FZiplineCurve& OtherCurve = *OtherRegistered->Curve;
+
+	// Join the closest pair of ends
+	int32 BestEnd = INDEX_NONE;
+	int32 BestOtherEnd = INDEX_NONE;
+	float BestDistSq = FMath::Square(JunctionTolerance);
+	for (int32 End = 0; End < 2; ++End)
+	{
+		for (int32 OtherEnd = 0; OtherEnd < 2; ++OtherEnd)
+		{
+			const float DistSq = FVector::DistSquared(End ? Curve.Points.Last() : Curve.Points[0], OtherEnd ? OtherCurve.Points.Last() : OtherCurve.Points[0]);
+			if (DistSq <= BestDistSq)
+			{
+				BestDistSq = DistSq;
+				BestEnd = End;
+				BestOtherEnd = OtherEnd;
+			}
+		}
+	}
+
+	if (BestEnd == INDEX_NONE)
+	{
+		UE_LOG(LogMover, Warning, TEXT("Ziplines %s and %s are connected but none of their ends are within %.0fcm"), *GetNameSafe(ZiplineActor), *GetNameSafe(OtherZipline), JunctionTolerance);
+		return;
+	}
+
+	// Riders arrive moving away from the far end, and leave moving away from the junction end
+	auto AddJunction = [](FRegisteredZipline& From, const FZiplineCurve& FromCurve, int32 FromEnd, AActor* To, const FZiplineCurve& ToCurve, int32 ToEnd)
+	{
+		const FVector ArrivingDirection = FromEnd ? FromCurve.GetDirectionAtProgress(1.0f) : -FromCurve.GetDirectionAtProgress(0.0f);
+		const FVector LeavingDirection = ToEnd ? -ToCurve.GetDirectionAtProgress(1.0f) : ToCurve.GetDirectionAtProgress(0.0f);
+		const float Alignment = ArrivingDirection | LeavingDirection;
+
+		FZiplineJunction& Junction = From.Junctions[FromEnd];
+		if (!Junction.NextZipline.IsValid() || Alignment > Junction.Alignment)
+		{
+			Junction.NextZipline = To;
+			Junction.bNextMovingAtoB = (ToEnd == 0);
+			Junction.Alignment = Alignment;
+		}
+	};
+
+	AddJunction(*Registered, Curve, BestEnd, OtherZipline, OtherCurve, BestOtherEnd);
+	AddJunction(*OtherRegistered, OtherCurve, BestOtherEnd, ZiplineActor, Curve, BestEnd);
+}
+
+const FZiplineJunction* UZiplineRegistrySubsystem::FindJunction(const AActor* ZiplineActor, bool bAtEndB) const
+{
+	const FRegisteredZipline* Registered = Ziplines.Find(ZiplineActor);
+	const FZiplineJunction* Junction = Registered ? &Registered->Junctions[bAtEndB ? 1 : 0] : nullptr;
+	return (Junction && Junction->NextZipline.IsValid()) ? Junction : nullptr;
+}
+
+AActor* UZiplineRegistrySubsystem::FindNearestZipline(const FVector& Location, float Radius, FVector* OutClosestPoint, float* OutProgress) const
+{
+	int32 SegmentIndex = INDEX_NONE;
+	FVector ClosestPoint;
+	if (!Grid.FindNearestSegment(Location, Radius, SegmentIndex, ClosestPoint))
+	{
+		return nullptr;
+	}
+
+	const FGridSegmentOwner& Owner = SegmentOwners[SegmentIndex];
+	AActor* ZiplineActor = Owner.ZiplineActor.Get();
+
+	if (OutClosestPoint)
+	{
+		*OutClosestPoint = ClosestPoint;
+	}
+
+	if (OutProgress)
+	{
+		const FRegisteredZipline* Registered = ZiplineActor ? Ziplines.Find(ZiplineActor) : nullptr;
+		*OutProgress = Registered ? Registered->Curve->GetProgressOnSpan(Owner.SpanIndex, ClosestPoint) : 0.0f;
+	}
+
+	return ZiplineActor;
+}
+
+TSharedPtr<const FZiplineCurve, ESPMode::ThreadSafe> UZiplineRegistrySubsystem::FindZiplineCurve(const AActor* ZiplineActor) const
+{
+	const FRegisteredZipline* Registered = Ziplines.Find(ZiplineActor);
+	return Registered ? Registered->Curve : nullptr;
+}
+
+bool UZiplineRegistrySubsystem::IsDynamicZipline(const AActor* ZiplineActor) const
+{
+	const FRegisteredZipline* Registered = Ziplines.Find(ZiplineActor);
+	return Registered && Registered->bIsDynamic;
+}
+
+uint32 UZiplineRegistrySubsystem::ComputeZiplineNetId(const AActor* ZiplineActor)
+{
+	if (!ZiplineActor->IsNameStableForNetworking())
+	{
+		return InvalidNetId;
+	}
+
+	// Strip the PIE prefix, so server and client worlds in the same editor session agree
+	const FString StablePath = UWorld::RemovePIEPrefix(ZiplineActor->GetPathName());
+	const uint32 NetId = FCrc::StrCrc32(*StablePath);
+	return (NetId != InvalidNetId) ? NetId : 1;
+}
+
+uint32 UZiplineRegistrySubsystem::GetZiplineNetId(const AActor* ZiplineActor) const
+{
+	const FRegisteredZipline* Registered = Ziplines.Find(ZiplineActor);
+	return Registered ? Registered->NetId : InvalidNetId;
+}
+
+AActor* UZiplineRegistrySubsystem::FindZiplineByNetId(uint32 NetId) const
+{
+	const TWeakObjectPtr<AActor>* Found = NetIdZiplines.Find(NetId);
+	return Found ? Found->Get() : nullptr;
+}
+
+
+#if !UE_BUILD_SHIPPING
+namespace ZiplineRegistry::Utils::Private
+{
+	// Usage: MoverExamples.Zipline.BenchmarkRegistry [NumZiplines] [NumCharacters] [NumFrames]
+	// Scatters ziplines and airborne characters over a 1km square and times each character's grab query, against a linear
+	// scan of every zipline, which is what testing each overlapping actor degrades to in dense areas.
+	static void BenchmarkRegistry(const TArray<FString>& Args)
+	{
+		const int32 NumZiplines = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000;
+		const int32 NumCharacters = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 100;
+		const int32 NumFrames = Args.Num() > 2 ? FMath::Max(1, FCString::Atoi(*Args[2])) : 1000;
+
+		constexpr float WorldExtent = 50000.0f;
+		constexpr float GrabRadius = 100.0f;
+
+		FRandomStream Random(1234);
+		FZiplineSpatialGrid TestGrid;
+		TArray<FZiplineSpatialGrid::FSegment> AllSegments;
+
+		for (int32 i = 0; i < NumZiplines; ++i)
+		{
+			FZiplineSpatialGrid::FSegment Segment;
+			Segment.Start = FVector(Random.FRandRange(-WorldExtent, WorldExtent), Random.FRandRange(-WorldExtent, WorldExtent), Random.FRandRange(500.0f, 3000.0f));
+			Segment.End = Segment.Start + FVector(Random.FRandRange(-3000.0f, 3000.0f), Random.FRandRange(-3000.0f, 3000.0f), -Random.FRandRange(0.0f, 500.0f));
+			Segment.bIsValid = true;
+
+			TestGrid.AddSegment(Segment.Start, Segment.End);
+			AllSegments.Add(Segment);
+		}
+
+		// Characters start near random ziplines so some queries hit, then drift each frame
+		TArray<FVector> Characters;
+		for (int32 i = 0; i < NumCharacters; ++i)
+		{
+			const FZiplineSpatialGrid::FSegment& Near = AllSegments[Random.RandHelper(NumZiplines)];
+			Characters.Add(FMath::Lerp(Near.Start, Near.End, Random.FRand()) + Random.VRand() * Random.FRandRange(0.0f, 2.0f * GrabRadius));
+		}
+
+		int32 LinearHits = 0;
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			for (const FVector& Character : Characters)
+			{
+				const FVector Location = Character + FVector(0.0f, 0.0f, -Frame);
+				for (const FZiplineSpatialGrid::FSegment& Segment : AllSegments)
+				{
+					if (FVector::DistSquared(Location, FMath::ClosestPointOnSegment(Location, Segment.Start, Segment.End)) <= FMath::Square(GrabRadius))
+					{
+						++LinearHits;
+						break;
+					}
+				}
+			}
+		}
+		const double LinearMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		int32 GridHits = 0;
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			for (const FVector& Character : Characters)
+			{
+				int32 SegmentIndex;
+				FVector ClosestPoint;
+				GridHits += TestGrid.FindNearestSegment(Character + FVector(0.0f, 0.0f, -Frame), GrabRadius, SegmentIndex, ClosestPoint) ? 1 : 0;
+			}
+		}
+		const double GridMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		UE_LOG(LogMover, Display, TEXT("Zipline registry: %d ziplines, %d characters, %d frames | linear %8.3f ms (%d hits) | grid %8.3f ms (%d hits) | grid per query %.3f us"),
+			NumZiplines, NumCharacters, NumFrames, LinearMs, LinearHits, GridMs, GridHits, (GridMs * 1000.0) / (double(NumFrames) * NumCharacters));
+	}
+
+	static FAutoConsoleCommand BenchmarkRegistryCmd(
+		TEXT("MoverExamples.Zipline.BenchmarkRegistry"),
+		TEXT("Times nearest grabbable zipline queries through the registry grid against a linear scan. Optional args: number of ziplines, characters and frames."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkRegistry));
+}
+#endif // !UE_BUILD_SHIPPING
@@ -5,13 +5,111 @@
 #include "MoverComponent.h"
 #include "CharacterVariants/Ziplining/ZiplineInterface.h"
 #include "CharacterVariants/Ziplining/ZipliningTransitions.h"
-#include "Kismet/KismetSystemLibrary.h"
+#include "CharacterVariants/Ziplining/ZiplineRegistrySubsystem.h"
 #include "DefaultMovementSet/Settings/CommonLegacyMovementSettings.h"
 #include "MoverLog.h"
+#include "MoverExamplesStats.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/World.h"
+#include "UObject/CoreNet.h"
 
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(ZipliningMode)
 
+DECLARE_CYCLE_STAT(TEXT("Ziplining Tick"), STAT_ZipliningTick, STATGROUP_MoverExamples);
+DECLARE_CYCLE_STAT(TEXT("Ziplining Hang Offset Refresh"), STAT_ZipliningHangOffsetRefresh, STATGROUP_MoverExamples);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ziplining Hang Offset Refreshes"), STAT_ZipliningHangOffsetRefreshes, STATGROUP_MoverExamples);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ziplining Hang Offset Reuses"), STAT_ZipliningHangOffsetReuses, STATGROUP_MoverExamples);
+
+namespace ZipliningMode::Utils::Private
+{
+	// Cheap stand-in for the mover's size: changes with capsule resizes such as crouching, but costs a couple of loads
+	// rather than walking every colliding component like GetActorBounds does
+	static float GetHangOffsetKey(const USceneComponent* UpdatedComponent)
+	{
+		if (const UCapsuleComponent* Capsule = Cast<UCapsuleComponent>(UpdatedComponent))
+		{
+			return Capsule->GetScaledCapsuleHalfHeight();
+		}
+
+		return UpdatedComponent ? UpdatedComponent->GetComponentScale().Z : 0.0f;
+	}
+
+	// Distance from the mover's origin up to where it hangs from the zipline (half its height)
+	static float ComputeHangOffset(const AActor* MoverActor)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_ZipliningHangOffsetRefresh);
+
+		FVector ActorOrigin;
+		FVector BoxExtent;
+		MoverActor->GetActorBounds(true, OUT ActorOrigin, OUT BoxExtent);
+		return BoxExtent.Z;
+	}
+
+	/**
+	 * Closed form of dv/dt = Accel - Drag * v over DeltaSeconds, holding the speed once it reaches MinSpeed or MaxSpeed.
+	 * Returns the distance travelled. Splitting DeltaSeconds into several calls gives the same result.
+	 */
+	static float IntegrateSpeed(float& InOutSpeed, float Accel, float Drag, float MinSpeed, float MaxSpeed, float DeltaSeconds)
+	{
+		const float V0 = FMath::Clamp(InOutSpeed, MinSpeed, MaxSpeed);
+
+		float FinalSpeed;
+		float Distance;
+		float Limit = 0.0f;
+		float TimeToLimit = UE_BIG_NUMBER;
+
+		if (Drag <= UE_KINDA_SMALL_NUMBER)
+		{
+			// Constant acceleration
+			FinalSpeed = V0 + (Accel * DeltaSeconds);
+			Distance = (V0 * DeltaSeconds) + (0.5f * Accel * DeltaSeconds * DeltaSeconds);
+
+			if (Accel != 0.0f)
+			{
+				Limit = (Accel > 0.0f) ? MaxSpeed : MinSpeed;
+				TimeToLimit = (Limit - V0) / Accel;
+			}
+
+			if (TimeToLimit < DeltaSeconds)
+			{
+				Distance = (V0 * TimeToLimit) + (0.5f * Accel * TimeToLimit * TimeToLimit);
+			}
+		}
+		else
+		{
+			// Exponential approach to the terminal speed: v(t) = vt + (v0 - vt)e^-kt, s(t) = vt*t + (v0 - vt)(1 - e^-kt)/k
+			const float TerminalSpeed = Accel / Drag;
+			const float Decay = FMath::Exp(-Drag * DeltaSeconds);
+			FinalSpeed = TerminalSpeed + ((V0 - TerminalSpeed) * Decay);
+			Distance = (TerminalSpeed * DeltaSeconds) + ((V0 - TerminalSpeed) * (1.0f - Decay) / Drag);
+
+			// Only a limit between the start and terminal speeds can be reached
+			if (TerminalSpeed > MaxSpeed || TerminalSpeed < MinSpeed)
+			{
+				Limit = (TerminalSpeed > MaxSpeed) ? MaxSpeed : MinSpeed;
+				TimeToLimit = FMath::Loge((V0 - TerminalSpeed) / (Limit - TerminalSpeed)) / Drag;
+			}
+
+			if (TimeToLimit < DeltaSeconds)
+			{
+				const float DecayToLimit = FMath::Exp(-Drag * TimeToLimit);
+				Distance = (TerminalSpeed * TimeToLimit) + ((V0 - TerminalSpeed) * (1.0f - DecayToLimit) / Drag);
+			}
+		}
+
+		if (TimeToLimit < DeltaSeconds)
+		{
+			// Coast at the limit for the rest of the step
+			InOutSpeed = Limit;
+			return Distance + (Limit * (DeltaSeconds - TimeToLimit));
+		}
+
+		InOutSpeed = FMath::Clamp(FinalSpeed, MinSpeed, MaxSpeed);
+		return Distance;
+	}
+}
+
 
 
 
@@ -20,21 +118,57 @@
 
 FMoverDataStructBase* FZipliningState::Clone() const
 {
-	FZipliningState* CopyPtr = new FZipliningState(*this);
-	return CopyPtr;
+	return TMoverDataStructPool<FZipliningState>::Create(*this);
 }
 
 /**
- * Actor 指针 → PackageMap
+ * Zipline → 32 位 registry id（没有 id 时才用 Actor 指针 → PackageMap）
  * bool → bit 压缩
+ * Progress → 16 位定点数
  */
 bool FZipliningState::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
 {
 	Super::NetSerialize(Ar, Map, bOutSuccess);
 
-	Ar << ZiplineActor;
+	bool bHasNetId = (ZiplineNetId != UZiplineRegistrySubsystem::InvalidNetId);
+	Ar.SerializeBits(&bHasNetId, 1);
+	if (bHasNetId)
+	{
+		Ar << ZiplineNetId;
+	}
+	else
+	{
+		Ar << ZiplineActor;
+	}
+
 	Ar.SerializeBits(&bIsMovingAtoB,1);
 
+	uint16 QuantizedProgress = static_cast<uint16>(FMath::RoundToInt32(FMath::Clamp(Progress, 0.0f, 1.0f) / ProgressQuantum));
+	Ar << QuantizedProgress;
+
+	// Packed rather than a fixed 16 bits, so MaxSpeed isn't capped by the wire format. Up to 1638 cm/s still takes 2 bytes.
+	uint32 QuantizedSpeed = static_cast<uint32>(FMath::Max(FMath::RoundToInt32(Speed / SpeedQuantum), 0));
+	Ar.SerializeIntPacked(QuantizedSpeed);
+
+	// The actor (when sent by id) and the curve aren't sent. Receivers look them up from the registry on their next
+	// simulation tick, never while reading packets.
+	if (Ar.IsLoading())
+	{
+		Progress = QuantizedProgress * ProgressQuantum;
+		Speed = QuantizedSpeed * SpeedQuantum;
+
+		if (bHasNetId)
+		{
+			ZiplineActor = nullptr;
+		}
+		else
+		{
+			ZiplineNetId = UZiplineRegistrySubsystem::InvalidNetId;
+		}
+
+		Curve.Reset();
+	}
+
 	bOutSuccess = true;
 	return true;
 }
@@ -43,19 +177,24 @@ void FZipliningState::ToString(FAnsiStringBuilderBase& Out) const
 {
 	Super::ToString(Out);
 
-	Out.Appendf("ZiplineActor: %s\n", *GetNameSafe(ZiplineActor));
+	Out.Appendf("ZiplineActor: %s (net id %u)\n", TCHAR_TO_ANSI(*GetNameSafe(ZiplineActor)), ZiplineNetId);
 	Out.Appendf("IsMovingAtoB: %d\n", bIsMovingAtoB);
+	Out.Appendf("Progress: %.4f\n", Progress);
+	Out.Appendf("Speed: %.2f\n", Speed);
 }
 /**
- * 如果 ZiplineActor 不同
+ * 如果 Zipline 不同
  * → 客户端必须 整体回滚 + 重演
+ * Progress 只在超过一个量化单位时才算不同
  */
 bool FZipliningState::ShouldReconcile(const FMoverDataStructBase& AuthorityState) const
 {
 	const FZipliningState* AuthorityZiplineState = static_cast<const FZipliningState*>(&AuthorityState);
 
-	return (ZiplineActor != AuthorityZiplineState->ZiplineActor) ||
-		   (bIsMovingAtoB != AuthorityZiplineState->bIsMovingAtoB);
+	return !IsSameZipline(*AuthorityZiplineState) ||
+		   (bIsMovingAtoB != AuthorityZiplineState->bIsMovingAtoB) ||
+		   (FMath::Abs(Progress - AuthorityZiplineState->Progress) > ProgressQuantum) ||
+		   (FMath::Abs(Speed - AuthorityZiplineState->Speed) > SpeedQuantum);
 }
 
 void FZipliningState::Interpolate(const FMoverDataStructBase& From, const FMoverDataStructBase& To, float Pct)
@@ -64,7 +203,62 @@ void FZipliningState::Interpolate(const FMoverDataStructBase& From, const FMover
 	const FZipliningState* ToState = static_cast<const FZipliningState*>(&To);
 
 	ZiplineActor = ToState->ZiplineActor;
+	ZiplineNetId = ToState->ZiplineNetId;
 	bIsMovingAtoB = ToState->bIsMovingAtoB;
+	bIsDynamicZipline = ToState->bIsDynamicZipline;
+	Curve = ToState->Curve;
+	HangOffset = ToState->HangOffset;
+	HangOffsetKey = ToState->HangOffsetKey;
+
+	// Only blend progress along the same ride
+	const bool bIsSameRide = FromState->IsSameZipline(*ToState) && (FromState->bIsMovingAtoB == ToState->bIsMovingAtoB);
+	Progress = bIsSameRide ? FMath::Lerp(FromState->Progress, ToState->Progress, Pct) : ToState->Progress;
+	Speed = bIsSameRide ? FMath::Lerp(FromState->Speed, ToState->Speed, Pct) : ToState->Speed;
+}
+
+bool FZipliningState::IsSameZipline(const FZipliningState& Other) const
+{
+	if (ZiplineNetId != UZiplineRegistrySubsystem::InvalidNetId || Other.ZiplineNetId != UZiplineRegistrySubsystem::InvalidNetId)
+	{
+		return ZiplineNetId == Other.ZiplineNetId;
+	}
+
+	return ZiplineActor == Other.ZiplineActor;
+}
+
+bool FZipliningState::ResolveZipline(const UWorld* World)
+{
+	if (!World && ZiplineActor)
+	{
+		World = ZiplineActor->GetWorld();
+	}
+
+	UZiplineRegistrySubsystem* ZiplineRegistry = World ? World->GetSubsystem<UZiplineRegistrySubsystem>() : nullptr;
+	if (!ZiplineRegistry)
+	{
+		Curve.Reset();
+		return false;
+	}
+
+	// Newly received, so we don't know anything about the zipline yet
+	if (!Curve.IsValid())
+	{
+		if (!ZiplineActor)
+		{
+			ZiplineActor = ZiplineRegistry->FindZiplineByNetId(ZiplineNetId);
+		}
+
+		bIsDynamicZipline = ZiplineRegistry->IsDynamicZipline(ZiplineActor);
+	}
+
+	if (!ZiplineActor)
+	{
+		return false;
+	}
+
+	// The registry rebuilds moved ziplines itself, once per frame. Riders only pick up the current curve.
+	Curve = ZiplineRegistry->FindZiplineCurve(ZiplineActor);
+	return Curve.IsValid();
 }
 
 
@@ -119,6 +313,10 @@ void UZipliningMode::GenerateMove_Implementation(const FMoverTickStartData& Star
  */
 void UZipliningMode::SimulationTick_Implementation(const FSimulationTickParams& Params, FMoverTickEndData& OutputState)
 {
+	using namespace ZipliningMode::Utils::Private;
+
+	SCOPE_CYCLE_COUNTER(STAT_ZipliningTick);
+
 	// Are we continuing a move or starting fresh?
 	/**
 	 * ████████ 阶段一：状态判断 - 新开始还是继续滑动？ ████████
@@ -148,9 +346,6 @@ void UZipliningMode::SimulationTick_Implementation(const FSimulationTickParams&
 	AActor* MoverActor = MoverComp->GetOwner();
 
 	// 滑索相关变量
-	USceneComponent* StartPoint = nullptr;// 滑索起点组件
-	USceneComponent* EndPoint = nullptr;// 滑索终点组件
-	FVector ZipDirection;// 滑索方向向量（从起点指向终点）
 	FVector FlatFacingDir;// 角色面向方向（投影到水平面）
 
 	// 时间转换：毫秒 → 秒, 本帧要模拟的时间长度
@@ -159,16 +354,28 @@ void UZipliningMode::SimulationTick_Implementation(const FSimulationTickParams&
 	// ████████ 计算角色边界偏移 ████████
     // 获取角色的边界框，用于计算角色中心到滑索的垂直偏移
     // 这样角色会悬挂在滑索下方，而不是身体卡在滑索里
-	FVector ActorOrigin;
-	FVector BoxExtent;
-	MoverActor->GetActorBounds(true, OUT ActorOrigin, OUT BoxExtent);
-	const FVector ActorToZiplineOffset = MoverComp->GetUpDirection() * BoxExtent.Z;// 向上方向 * 半身高度
+	// 边界只在进入滑索或胶囊体尺寸变化（如蹲伏）时重新计算
+	float HangOffset = StartingZipState ? StartingZipState->HangOffset : -1.0f;
+	const float HangOffsetKey = GetHangOffsetKey(UpdatedComponent);
+	if (HangOffset < 0.0f || HangOffsetKey != StartingZipState->HangOffsetKey)
+	{
+		HangOffset = ComputeHangOffset(MoverActor);
+		INC_DWORD_STAT(STAT_ZipliningHangOffsetRefreshes);
+	}
+	else
+	{
+		INC_DWORD_STAT(STAT_ZipliningHangOffsetReuses);
+	}
+	const FVector ActorToZiplineOffset = MoverComp->GetUpDirection() * HangOffset;// 向上方向 * 半身高度
+
+	FMovementRecord MoveRecord;
+	MoveRecord.SetDeltaSeconds(DeltaSeconds);
 
 	 // ████████ 阶段二：初始化逻辑 - 第一次进入滑索 ████████
 	if (!StartingZipState) // 2. 如果没有起始滑索状态，说明是第一次接触滑索，需要初始化
 	{
 		// There is no existing zipline state... so let's find the target
-		//    A) teleport to the closest starting point, set the zip direction
+		//    A) move to the closest starting point, set the zip direction
 		//    B) choose the appropriate facing direction
 		//    C) choose the appropriate initial velocity
 		/**
@@ -177,65 +384,70 @@ void UZipliningMode::SimulationTick_Implementation(const FSimulationTickParams&
 		 * B)选择合适的面向方向
 		 * C)选择合适的初始速度 tarray OverlappingActors；
 		 */
-		TArray<AActor*> OverlappingActors;
-		// 获取所有与角色重叠的Actor，从中寻找滑索
-		MoverComp->GetOwner()->GetOverlappingActors(OUT OverlappingActors);
+		// 获取角色当前位置
+		const FVector MoverLoc = UpdatedComponent->GetComponentLocation();
 
-		for (AActor* CandidateActor : OverlappingActors)
-		{
-			// 检查Actor是否实现了滑索接口
-			bool bIsZipline = UKismetSystemLibrary::DoesImplementInterface(CandidateActor, UZipline::StaticClass());
+		// Ask the registry for the closest zipline in reach, rather than scanning overlapping actors
+		const UZiplineRegistrySubsystem* ZiplineRegistry = MoverActor->GetWorld()->GetSubsystem<UZiplineRegistrySubsystem>();
+		float GrabProgress = 0.0f;
+		AActor* CandidateActor = ZiplineRegistry ? ZiplineRegistry->FindNearestZipline(MoverLoc, GrabRadius, nullptr, &GrabProgress) : nullptr;
 
-			if (bIsZipline)
+		bool bFoundZipline = false;
+		if (CandidateActor)
+		{
+			// Keep the zipline's shared curve, so following ticks don't need the interface (unless the zipline moves)
+			OutZipState.ZiplineActor = CandidateActor;
+			OutZipState.ZiplineNetId = ZiplineRegistry->GetZiplineNetId(CandidateActor);
+			OutZipState.bIsDynamicZipline = ZiplineRegistry->IsDynamicZipline(CandidateActor);
+			OutZipState.Curve = ZiplineRegistry->FindZiplineCurve(CandidateActor);
+
+			// Start the ride where the cable was grabbed, heading whichever way the mover faces. At an end, the only way is
+			// along the cable.
+			if (const FZiplineCurve* Curve = OutZipState.Curve.Get())
 			{
-				// 获取角色当前位置
-				const FVector MoverLoc = UpdatedComponent->GetComponentLocation();
-				// 获取滑索的两个端点
-				USceneComponent* ZipPointA = IZipline::Execute_GetStartComponent(CandidateActor);
-				USceneComponent* ZipPointB = IZipline::Execute_GetEndComponent(CandidateActor);
-
-				// 计算角色到两个端点的距离，选择更近的作为起点
-                // 这样无论从哪个方向接近滑索，角色都会从最近点开始滑行
-				if (FVector::DistSquared(ZipPointA->GetComponentLocation(), MoverLoc) < FVector::DistSquared(ZipPointB->GetComponentLocation(), MoverLoc))
+				// 标记为从A到B移动 / 从B到A移动
+				const FVector FacingDir = UpdatedComponent->GetForwardVector();
+				OutZipState.Progress = FMath::Clamp(GrabProgress, 0.0f, 1.0f);
+				if (OutZipState.Progress <= FZipliningState::ProgressQuantum || OutZipState.Progress >= 1.0f - FZipliningState::ProgressQuantum)
 				{
-					OutZipState.bIsMovingAtoB = true;// 标记为从A到B移动
-					StartPoint = ZipPointA;// 设置起点
-					EndPoint = ZipPointB;// 设置终点
+					OutZipState.bIsMovingAtoB = (OutZipState.Progress < 0.5f);
 				}
 				else
 				{
-					OutZipState.bIsMovingAtoB = false;// 标记为从B到A移动
-					StartPoint = ZipPointB;// 设置起点（B点）
-					EndPoint = ZipPointA;// 设置终点（A点）
+					OutZipState.bIsMovingAtoB = (Curve->GetDirectionAtProgress(OutZipState.Progress) | FacingDir) >= 0.0f;
 				}
+				OutZipState.Speed = FMath::Clamp(InitialSpeed, MinSpeed, FMath::Max(MinSpeed, MaxSpeed));
+				bFoundZipline = true;
+			}
+		}
 
-				// 计算滑索方向：从起点指向终点的单位向量
-				ZipDirection = (EndPoint->GetComponentLocation() - StartPoint->GetComponentLocation()).GetSafeNormal();
-
-				// ████████ 角色位置校准 ████████
+		if (bFoundZipline)
+		{
+			// ████████ 角色位置校准 ████████
                 // 计算传送位置：起点位置 - 角色高度偏移
                 // 这样角色会悬挂在滑索的正下方，而不是身体卡在滑索里
-				const FVector WarpLocation = StartPoint->GetComponentLocation() - ActorToZiplineOffset;
+			const FVector WarpLocation = OutZipState.Curve->GetLocationAtProgress(OutZipState.Progress) - ActorToZiplineOffset;
 
-				// 计算角色面向方向：将滑索方向投影到角色所在的平面（通常是水平面）
+			// 计算角色面向方向：将滑索方向投影到角色所在的平面（通常是水平面）
                 // 这样角色会面朝移动方向
-				FlatFacingDir = FVector::VectorPlaneProject(ZipDirection, MoverComp->GetUpDirection()).GetSafeNormal();
-
-				// 保存滑索Actor引用到状态，供后续帧使用
-				OutZipState.ZiplineActor = CandidateActor;
-
-				//将角色传送到计算好的起点位置，并设置面向方向 ,传送 到起点
-				UpdatedComponent->GetOwner()->TeleportTo(WarpLocation, FlatFacingDir.ToOrientationRotator());
-
-				break;
-			}
+			const FVector ZipDirection = OutZipState.Curve->GetDirectionAtProgress(OutZipState.Progress) * (OutZipState.bIsMovingAtoB ? 1.0f : -1.0f);
+			FlatFacingDir = FVector::VectorPlaneProject(ZipDirection, MoverComp->GetUpDirection()).GetSafeNormal();
+
+			//将角色扫掠移动到计算好的起点位置，并设置面向方向
+			// Move onto the hang point with a single sweep through the simulation, rather than teleporting the actor.
+			// Blocked short of it, the step below keeps pulling the mover onto the cable. The snap isn't part of the
+			// ride, so it's kept out of the resulting velocity.
+			FHitResult GrabHit(1.f);
+			MoveRecord.LockRelevancy(false);
+			UMovementUtils::TrySafeMoveUpdatedComponent(Params.MovingComps, WarpLocation - MoverLoc, FlatFacingDir.ToOrientationQuat(), true, GrabHit, ETeleportType::TeleportPhysics, MoveRecord);
+			MoveRecord.UnlockRelevancy();
 		}
 
 		// If we were unable to find a valid target zipline, refund all the time and let the actor fall
 		 // ████████ 错误处理 ████████
         // 如果没有找到有效的滑索（起点或终点为空），说明初始化失败
         // 这种情况下，将角色切换到默认的空中模式（自由落体），并退还本帧剩余时间
-		if (!StartPoint || !EndPoint)
+		if (!bFoundZipline)
 		{
 			// 获取默认的空中模式名称（通常是"Falling"）
 			FName DefaultAirMode = DefaultModeNames::Falling;
@@ -262,31 +474,30 @@ void UZipliningMode::SimulationTick_Implementation(const FSimulationTickParams&
 	}
 	else// ████████ 阶段三：继续滑动逻辑 - 非首次进入 ████████
 	{
-		check(StartingZipState->ZiplineActor); // 断言：滑索Actor必须存在
 		// 复制之前的滑索状态到输出状态
 		OutZipState = *StartingZipState;
 
-		// 获取滑索的两个端点
-		USceneComponent* ZipPointA = IZipline::Execute_GetStartComponent(StartingZipState->ZiplineActor);
-		USceneComponent* ZipPointB = IZipline::Execute_GetEndComponent(StartingZipState->ZiplineActor);
-
-		 // 根据之前记录的移动方向，确定当前起点和终点
-		if (StartingZipState->bIsMovingAtoB)
-		{
-			StartPoint = ZipPointA;
-			EndPoint = ZipPointB;
-		}
-		else
+		// The curve was cached when grabbed, or is missing if the state was just received. Only ziplines that actually
+		// move need it looked up again.
+		if (OutZipState.bIsDynamicZipline || !OutZipState.Curve.IsValid() || !OutZipState.ZiplineActor)
 		{
-			StartPoint = ZipPointB;
-			EndPoint = ZipPointA;
+			if (!OutZipState.ResolveZipline(MoverActor->GetWorld()))
+			{
+				// The zipline is gone, so let go of it
+				OutputState.MovementEndState.NextModeName = DefaultModeNames::Falling;
+				if (UCommonLegacyMovementSettings* LegacySettings = MoverComp->FindSharedSettings_Mutable<UCommonLegacyMovementSettings>())
+				{
+					OutputState.MovementEndState.NextModeName = LegacySettings->AirMovementModeName;
+				}
+				OutputState.MovementEndState.RemainingMs = Params.TimeStep.StepMs;
+				return;
+			}
 		}
-
-		// 重新计算滑索方向（考虑滑索可能在运动）
-		ZipDirection = (EndPoint->GetComponentLocation() - StartPoint->GetComponentLocation()).GetSafeNormal();
-		FlatFacingDir = FVector::VectorPlaneProject(ZipDirection, MoverComp->GetUpDirection()).GetSafeNormal();
 	}
 
+	OutZipState.HangOffset = HangOffset;
+	OutZipState.HangOffsetKey = HangOffsetKey;
+
 
 	// 沿 Zipline 移动, 计算本帧的移动, 当前在滑索上的起点位置（角色位置 + 偏移量，得到滑索上的实际悬挂点）
 	// Now let's slide along the zipline
@@ -294,32 +505,58 @@ void UZipliningMode::SimulationTick_Implementation(const FSimulationTickParams&
 
 
 	// ████████ 运动学计算 ████████
-    // 计算期望的终点位置：起点 + 方向 * 速度 * 时间
-    // 使用MaxSpeed作为恒定速度，TODO：未来可以做成动态的（如加速/减速）
-    // 这种计算方法保证完全确定性，不会超出线段范围
-	// DesiredEndPos = Start + Direction * Speed * Δt;
-	// ✔ 保证不会超出线段
+    // 速度由坡度（重力）和阻力决定，按解析解积分，结果与帧率无关
+	// The slope is taken where the step starts, so the integration is exact along straight ziplines and each straight
+	// span of a sagging one. Distance along the arc length is a change in progress along the shared curve.
+	// ✔ 保证不会超出滑索
 	// ✔ 完全 deterministic
-	const FVector DesiredEndPos = StepStartPos + (ZipDirection * MaxSpeed * DeltaSeconds);	// TODO: Make speed more dynamic，
+	const float SlopeAcceleration = ComputeSlopeAcceleration(*OutZipState.Curve, OutZipState.Progress, OutZipState.bIsMovingAtoB ? 1.0f : -1.0f, MoverComp->GetUpDirection());
+	float RemainingDistance = AdvanceSpeed(OutZipState.Speed, SlopeAcceleration, DeltaSeconds);
 
 
 	// ████████ 边界约束 ████████
-    // 将期望终点限制在滑索线段上，确保不会滑出滑索范围
-    // 如果超过终点，会返回线段上最近的点（即终点）
-	FVector ActualEndPos = FMath::ClosestPointOnSegment(DesiredEndPos,
-		StartPoint->GetComponentLocation(),
-		EndPoint->GetComponentLocation());
+    // 将进度限制在滑索范围内，确保不会滑出滑索
+	// Distance left over past the end of a zipline carries on along the next one in the network, so riders pass
+	// through junctions without letting go. Only a dead end drops them.
+	const UZiplineRegistrySubsystem* ZiplineRegistry = MoverActor->GetWorld()->GetSubsystem<UZiplineRegistrySubsystem>();
+	bool bWillReachEndPosition = false;
+	for (int32 NumTransfers = 0; ; ++NumTransfers)
+	{
+		const float DistanceToEnd = (OutZipState.bIsMovingAtoB ? (1.0f - OutZipState.Progress) : OutZipState.Progress) * OutZipState.Curve->Length;
+		if (RemainingDistance < DistanceToEnd)
+		{
+			const float DeltaProgress = RemainingDistance / OutZipState.Curve->Length;
+			OutZipState.Progress = FMath::Clamp(OutZipState.Progress + (OutZipState.bIsMovingAtoB ? DeltaProgress : -DeltaProgress), 0.0f, 1.0f);
+			break;
+		}
 
-	// 判断是否即将到达终点：如果实际终点和终点的距离几乎为零
-	bool bWillReachEndPosition = (ActualEndPos - EndPoint->GetComponentLocation()).IsNearlyZero();
+		OutZipState.Progress = OutZipState.bIsMovingAtoB ? 1.0f : 0.0f;
+		if (NumTransfers == MaxTransfersPerStep)
+		{
+			// Hold at the junction, the next step carries on through it
+			break;
+		}
 
-	// 准备移动记录，用于记录本次移动的详细信息
-	FVector MoveDelta = ActualEndPos - StepStartPos;
+		if (!ZiplineRegistry || !TransferToNextZipline(OutZipState, *ZiplineRegistry))
+		{
+			// 判断是否即将到达终点
+			bWillReachEndPosition = true;
+			break;
+		}
 
+		RemainingDistance -= DistanceToEnd;
+	}
 
+	const FZiplineCurve& Curve = *OutZipState.Curve;
+	const float DirectionSign = OutZipState.bIsMovingAtoB ? 1.0f : -1.0f;
+	const FVector ActualEndPos = Curve.GetLocationAtProgress(OutZipState.Progress);
+
+	// Face along the cable where we'll be
+	FlatFacingDir = FVector::VectorPlaneProject(Curve.GetDirectionAtProgress(OutZipState.Progress) * DirectionSign, MoverComp->GetUpDirection()).GetSafeNormal();
+
+	// 本次移动：从当前悬挂点到曲线上的新位置
+	FVector MoveDelta = ActualEndPos - StepStartPos;
 
-	FMovementRecord MoveRecord;
-	MoveRecord.SetDeltaSeconds(DeltaSeconds);
 
 
 	// ████████ 物理移动 ████████
@@ -380,4 +617,69 @@ void UZipliningMode::SimulationTick_Implementation(const FSimulationTickParams&
 }
 
 
+float UZipliningMode::AdvanceSpeed(float& InOutSpeed, float SlopeAcceleration, float DeltaSeconds) const
+{
+	return ZipliningMode::Utils::Private::IntegrateSpeed(InOutSpeed, SlopeAcceleration, Drag, MinSpeed, FMath::Max(MinSpeed, MaxSpeed), DeltaSeconds);
+}
 
+float UZipliningMode::ComputeSlopeAcceleration(const FZiplineCurve& Curve, float Progress, float DirectionSign, const FVector& UpDirection) const
+{
+	const FVector TravelDirection = Curve.GetDirectionAtProgress(Progress) * DirectionSign;
+	return -Gravity * (TravelDirection | UpDirection);
+}
+
+bool UZipliningMode::TransferToNextZipline(FZipliningState& ZipState, const UZiplineRegistrySubsystem& ZiplineRegistry) const
+{
+	const FZiplineJunction* Junction = ZiplineRegistry.FindJunction(ZipState.ZiplineActor, ZipState.bIsMovingAtoB);
+	AActor* NextZipline = Junction ? Junction->NextZipline.Get() : nullptr;
+	if (!NextZipline)
+	{
+		return false;
+	}
+
+	TSharedPtr<const FZiplineCurve, ESPMode::ThreadSafe> NextCurve = ZiplineRegistry.FindZiplineCurve(NextZipline);
+	if (!NextCurve.IsValid())
+	{
+		return false;
+	}
+
+	ZipState.ZiplineActor = NextZipline;
+	ZipState.ZiplineNetId = ZiplineRegistry.GetZiplineNetId(NextZipline);
+	ZipState.bIsDynamicZipline = ZiplineRegistry.IsDynamicZipline(NextZipline);
+	ZipState.Curve = MoveTemp(NextCurve);
+	ZipState.bIsMovingAtoB = Junction->bNextMovingAtoB;
+	ZipState.Progress = Junction->bNextMovingAtoB ? 0.0f : 1.0f;
+	return true;
+}
+
+FTransform UZipliningMode::EvaluateAtTime(const FMoverSyncState& SyncState, float Seconds) const
+{
+	const FMoverDefaultSyncState* MoveState = SyncState.SyncStateCollection.FindDataByType<FMoverDefaultSyncState>();
+	const FZipliningState* ZipState = SyncState.SyncStateCollection.FindDataByType<FZipliningState>();
+
+	const FVector CurrentLocation = MoveState ? MoveState->GetLocation_WorldSpace() : FVector::ZeroVector;
+	const FTransform CurrentTransform(MoveState ? MoveState->GetOrientation_WorldSpace() : FRotator::ZeroRotator, CurrentLocation);
+
+	const UMoverComponent* MoverComp = GetMoverComponent();
+	const FZiplineCurve* Curve = ZipState ? ZipState->Curve.Get() : nullptr;
+	if (!Curve || !MoverComp)
+	{
+		return CurrentTransform;
+	}
+
+	// Integrate ahead with the current slope, like a single simulation step would. Looking back, assume the current speed.
+	const float DirectionSign = ZipState->bIsMovingAtoB ? 1.0f : -1.0f;
+	float Speed = ZipState->Speed;
+	const float Distance = (Seconds > 0.0f) ? AdvanceSpeed(Speed, ComputeSlopeAcceleration(*Curve, ZipState->Progress, DirectionSign, MoverComp->GetUpDirection()), Seconds) : (Speed * Seconds);
+	const float DeltaProgress = (Curve->Length > UE_KINDA_SMALL_NUMBER) ? (Distance / Curve->Length) : 0.0f;
+	const float TargetProgress = FMath::Clamp(ZipState->Progress + (DirectionSign * DeltaProgress), 0.0f, 1.0f);
+
+	const FVector ZipDirection = Curve->GetDirectionAtProgress(TargetProgress) * DirectionSign;
+	const FVector FlatFacingDir = FVector::VectorPlaneProject(ZipDirection, MoverComp->GetUpDirection()).GetSafeNormal();
+
+	// Same hang offset as the simulation uses
+	const float HangOffset = (ZipState->HangOffset >= 0.0f) ? ZipState->HangOffset : ZipliningMode::Utils::Private::ComputeHangOffset(MoverComp->GetOwner());
+	const FVector ActorToZiplineOffset = MoverComp->GetUpDirection() * HangOffset;
+
+	return FTransform(FlatFacingDir.ToOrientationRotator(), Curve->GetLocationAtProgress(TargetProgress) - ActorToZiplineOffset);
+}
@@ -3,9 +3,9 @@
 #include "CharacterVariants/Ziplining/ZipliningTransitions.h"
 #include "CharacterVariants/AbilityInputs.h"
 #include "CharacterVariants/Ziplining/ZiplineInterface.h"
+#include "CharacterVariants/Ziplining/ZiplineRegistrySubsystem.h"
 #include "DefaultMovementSet/CharacterMoverComponent.h"
 #include "GameFramework/Actor.h"
-#include "Kismet/KismetSystemLibrary.h"
 
 
 // UZiplineStartTransition //////////////////////////////
@@ -15,6 +15,61 @@ UZiplineStartTransition::UZiplineStartTransition(const FObjectInitializer& Objec
 {
 }
 
+void UZiplineStartTransition::OnRegistered()
+{
+	Super::OnRegistered();
+
+	const UMoverComponent* MoverComp = GetTypedOuter<UMoverComponent>();
+	AActor* OwnerActor = MoverComp ? MoverComp->GetOwner() : nullptr;
+	if (!bTrackOverlappingZiplines || !OwnerActor)
+	{
+		return;
+	}
+
+	TrackedActor = OwnerActor;
+	OwnerActor->OnActorBeginOverlap.AddDynamic(this, &UZiplineStartTransition::OnOwnerBeginOverlap);
+	OwnerActor->OnActorEndOverlap.AddDynamic(this, &UZiplineStartTransition::OnOwnerEndOverlap);
+
+	// Pick up anything we were already touching before we started listening
+	TArray<AActor*> OverlappingActors;
+	OwnerActor->GetOverlappingActors(OUT OverlappingActors);
+	for (AActor* OverlappingActor : OverlappingActors)
+	{
+		OnOwnerBeginOverlap(OwnerActor, OverlappingActor);
+	}
+}
+
+void UZiplineStartTransition::OnUnregistered()
+{
+	if (AActor* OwnerActor = TrackedActor.Get())
+	{
+		OwnerActor->OnActorBeginOverlap.RemoveDynamic(this, &UZiplineStartTransition::OnOwnerBeginOverlap);
+		OwnerActor->OnActorEndOverlap.RemoveDynamic(this, &UZiplineStartTransition::OnOwnerEndOverlap);
+	}
+
+	TrackedActor.Reset();
+	OverlappingZiplines.Reset();
+
+	Super::OnUnregistered();
+}
+
+void UZiplineStartTransition::OnOwnerBeginOverlap(AActor* OverlappedActor, AActor* OtherActor)
+{
+	if (OtherActor && OtherActor->Implements<UZipline>())
+	{
+		OverlappingZiplines.AddUnique(OtherActor);
+	}
+}
+
+void UZiplineStartTransition::OnOwnerEndOverlap(AActor* OverlappedActor, AActor* OtherActor)
+{
+	// Also drop any zipline destroyed without an end overlap
+	OverlappingZiplines.RemoveAll([OtherActor](const TWeakObjectPtr<AActor>& Zipline)
+	{
+		return !Zipline.IsValid() || Zipline.Get() == OtherActor;
+	});
+}
+
 /**
  * UZiplineStartTransition 在 1 个 Simulation Frame 内可能会被 多次 Evaluate，但它最多只会成功触发一次 Mode 切换
  * 
@@ -52,27 +107,25 @@ FTransitionEvalResult UZiplineStartTransition::Evaluate_Implementation(const FSi
 	if (MoverComp && MoverComp->IsAirborne() && SyncState.MovementMode != ZipliningModeName)
 	{
 		// 从输入命令中查找能力输入（是否按下滑索键）
-		// 使用FindDataByType是因为输入是变体类型集合，支持扩展
-		if (const FMoverExampleAbilityInputs* AbilityInputs = Params.StartState.InputCmd.InputCollection.FindDataByType<FMoverExampleAbilityInputs>())
+		// 使用FindOrDefault是因为没有按键时能力输入会被省略
+		const FMoverExampleAbilityInputs& AbilityInputs = FMoverExampleAbilityInputs::FindOrDefault(Params.StartState.InputCmd.InputCollection);
+
+		// 检查玩家是否按下了"开始滑索"的输入键
+		// Overlapping a zipline's volume doesn't mean its cable is in reach, so that only saves the search below when
+		// nothing is touching the mover
+		if (AbilityInputs.WantsToStartZiplining() && (!bTrackOverlappingZiplines || !OverlappingZiplines.IsEmpty()))
 		{
-			// 检查玩家是否按下了"开始滑索"的输入键
-			if (AbilityInputs->bWantsToStartZiplining)
-			{
-				// 获取所有与角色重叠的Actor
-				// 这是检测角色是否接触到滑索的关键
-				TArray<AActor*> OverlappingActors;
-				MoverComp->GetOwner()->GetOverlappingActors(OUT OverlappingActors);
+			// 如果找到滑索，立即设置切换到滑索模式
+			// Use the same reach as the ziplining mode, so the mode is guaranteed to find the zipline we found here
+			const UZipliningMode* ZipliningMode = Cast<UZipliningMode>(MoverComp->MovementModes.FindRef(ZipliningModeName));
+			const UZiplineRegistrySubsystem* ZiplineRegistry = MoverComp->GetWorld()->GetSubsystem<UZiplineRegistrySubsystem>();
 
-				// 如果找到滑索，立即设置切换到滑索模式
-				for (AActor* CandidateActor : OverlappingActors)
+			if (ZipliningMode && ZiplineRegistry)
+			{
+				const FVector MoverLoc = Params.MovingComps.UpdatedComponent->GetComponentLocation();
+				if (ZiplineRegistry->FindNearestZipline(MoverLoc, ZipliningMode->GrabRadius))
 				{
-					bool bIsZipline = UKismetSystemLibrary::DoesImplementInterface(CandidateActor, UZipline::StaticClass());
-
-					if (bIsZipline)
-					{
-						EvalResult.NextMode = ZipliningModeName;
-						break;
-					}
+					EvalResult.NextMode = ZipliningModeName;
 				}
 			}
 		}
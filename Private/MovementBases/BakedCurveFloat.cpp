@@ -0,0 +1,149 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "MovementBases/BakedCurveFloat.h"
+
+#include "MoverLog.h"
+#include "Curves/CurveFloat.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/UObjectGlobals.h"
+#include <atomic>
+
+namespace BakedCurveFloat::Private
+{
+	struct FRegistry
+	{
+		FRWLock Lock;
+		TMap<TObjectKey<UCurveFloat>, TSharedPtr<const FBakedCurveFloat, ESPMode::ThreadSafe>> Tables;
+		std::atomic<uint32> Generation { 1 };
+	};
+
+#if WITH_EDITOR
+	static FDelegateHandle ObjectPropertyChangedHandle;
+#endif // WITH_EDITOR
+
+	static FRegistry& GetRegistry()
+	{
+		static FRegistry Registry;
+		return Registry;
+	}
+}
+
+TSharedPtr<const FBakedCurveFloat, ESPMode::ThreadSafe> FBakedCurveFloat::FindOrBake(const UCurveFloat* Curve)
+{
+	using namespace BakedCurveFloat::Private;
+
+	if (!Curve)
+	{
+		return nullptr;
+	}
+
+	FRegistry& Registry = GetRegistry();
+	const TObjectKey<UCurveFloat> Key(Curve);
+
+	{
+		FReadScopeLock ReadLock(Registry.Lock);
+		if (const TSharedPtr<const FBakedCurveFloat, ESPMode::ThreadSafe>* Found = Registry.Tables.Find(Key))
+		{
+			return *Found;
+		}
+	}
+
+	FWriteScopeLock WriteLock(Registry.Lock);
+
+	// Someone else may have baked while we waited for the lock
+	if (const TSharedPtr<const FBakedCurveFloat, ESPMode::ThreadSafe>* Found = Registry.Tables.Find(Key))
+	{
+		return *Found;
+	}
+
+	// Drop tables whose curves are gone before adding another
+	for (auto It = Registry.Tables.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().ResolveObjectPtr())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	TSharedPtr<FBakedCurveFloat, ESPMode::ThreadSafe> NewTable = MakeShared<FBakedCurveFloat, ESPMode::ThreadSafe>();
+	NewTable->Bake(*Curve);
+	Registry.Tables.Add(Key, NewTable);
+	return NewTable;
+}
+
+void FBakedCurveFloat::StartWatchingCurveEdits()
+{
+#if WITH_EDITOR
+	using namespace BakedCurveFloat::Private;
+
+	// Curve edits don't bump any version we could check cheaply, so drop the table as soon as one is edited
+	if (!ObjectPropertyChangedHandle.IsValid())
+	{
+		ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddLambda([](UObject* Object, FPropertyChangedEvent&)
+		{
+			if (const UCurveFloat* Curve = Cast<UCurveFloat>(Object))
+			{
+				FBakedCurveFloat::Invalidate(Curve);
+			}
+		});
+	}
+#endif // WITH_EDITOR
+}
+
+void FBakedCurveFloat::StopWatchingCurveEdits()
+{
+#if WITH_EDITOR
+	using namespace BakedCurveFloat::Private;
+
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+	ObjectPropertyChangedHandle.Reset();
+#endif // WITH_EDITOR
+}
+
+uint32 FBakedCurveFloat::GetCurrentGeneration()
+{
+	return BakedCurveFloat::Private::GetRegistry().Generation.load(std::memory_order_acquire);
+}
+
+void FBakedCurveFloat::Invalidate(const UCurveFloat* Curve)
+{
+	using namespace BakedCurveFloat::Private;
+
+	FRegistry& Registry = GetRegistry();
+
+	FWriteScopeLock WriteLock(Registry.Lock);
+	if (Registry.Tables.Remove(TObjectKey<UCurveFloat>(Curve)) > 0)
+	{
+		Registry.Generation.fetch_add(1, std::memory_order_acq_rel);
+	}
+}
+
+void FBakedCurveFloat::Bake(const UCurveFloat& Curve)
+{
+	SourceCurve = &Curve;
+
+	constexpr float SampleInterval = 1.0f / (NumSamples - 1);
+
+	Values.SetNumUninitialized(NumSamples);
+	for (int32 SampleIdx = 0; SampleIdx < NumSamples; ++SampleIdx)
+	{
+		Values[SampleIdx] = Curve.GetFloatValue(SampleIdx * SampleInterval);
+	}
+
+	// Measure between samples, where linear interpolation strays furthest from the curve
+	constexpr int32 NumErrorChecksPerInterval = 4;
+	MaxError = 0.0f;
+	for (int32 SampleIdx = 0; SampleIdx < NumSamples - 1; ++SampleIdx)
+	{
+		for (int32 CheckIdx = 1; CheckIdx < NumErrorChecksPerInterval; ++CheckIdx)
+		{
+			const float Alpha = static_cast<float>(CheckIdx) / NumErrorChecksPerInterval;
+			const float Time = (SampleIdx + Alpha) * SampleInterval;
+			const float Error = FMath::Abs(Curve.GetFloatValue(Time) - FMath::Lerp(Values[SampleIdx], Values[SampleIdx + 1], Alpha));
+			MaxError = FMath::Max(MaxError, Error);
+		}
+	}
+
+	UE_LOG(LogMover, Verbose, TEXT("Baked interpolation curve %s into %d samples, max error %f"), *Curve.GetPathName(), NumSamples, MaxError);
+}
@@ -0,0 +1,46 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "MovementBases/FollowPathAsset.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FollowPathAsset)
+
+
+void UFollowPathAsset::SetPathPoints(const TArray<FVector>& NewPathPoints)
+{
+	PathPoints = NewPathPoints;
+	BakePath();
+}
+
+const FFollowPathBakedTable& UFollowPathAsset::GetBakedPath() const
+{
+	ensureMsgf(BakedPath.NumPoints() == PathPoints.Num(), TEXT("%s: PathPoints were changed without SetPathPoints, so the baked path is stale"), *GetPathName());
+	return BakedPath;
+}
+
+void UFollowPathAsset::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	BakePath();
+}
+
+void UFollowPathAsset::PostLoad()
+{
+	Super::PostLoad();
+
+	BakePath();
+}
+
+#if WITH_EDITOR
+void UFollowPathAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	BakePath();
+}
+#endif // WITH_EDITOR
+
+void UFollowPathAsset::BakePath()
+{
+	BakedPath.Build(PathPoints);
+}
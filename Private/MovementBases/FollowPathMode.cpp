@@ -1,11 +1,192 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "MovementBases/FollowPathMode.h"
+#include "MovementBases/FollowPathAsset.h"
 #include "MoveLibrary/MovementUtils.h"
+#include "Algo/BinarySearch.h"
+#include "HAL/IConsoleManager.h"
+#include "MoverLog.h"
+#include "UObject/CoreNet.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FollowPathMode)
 
+namespace FollowPathMode::Utils::Private
+{
+	// BaseLocation isn't sent every time, so a received state may be missing it. It's wherever the mover is, less how
+	// far along the path it is. CurrentSegment isn't replicated either, so it's only used as a hint for finding the
+	// segment.
+	static FVector GetBaseLocation(const FFollowPathState& PathState, const FFollowPathBakedTable& BakedPath, const FVector& CurrentLocation)
+	{
+		if (PathState.bHasBaseLocation)
+		{
+			return PathState.BaseLocation;
+		}
+
+		const int32 Segment = BakedPath.FindSegment(PathState.CurrentPathPos, PathState.CurrentSegment);
+		return CurrentLocation - BakedPath.EvaluatePosition(PathState.CurrentPathPos, Segment);
+	}
+}
+
+
+void FFollowPathBakedTable::Reset()
+{
+	Positions.Reset();
+	PointTangents.Reset();
+	StartPcts.Reset();
+	SegmentInvPcts.Reset();
+	SegmentDirections.Reset();
+	TotalDistance = 0.f;
+}
+
+void FFollowPathBakedTable::Build(const TArray<FInterpControlPoint>& ControlPoints, const FVector& BaseLocation)
+{
+	Reset();
+
+	// Resolve every point into the same space, so evaluation never needs to care which were relative
+	Positions.SetNumUninitialized(ControlPoints.Num());
+	for (int32 i = 0; i < ControlPoints.Num(); ++i)
+	{
+		const FInterpControlPoint& ControlPoint = ControlPoints[i];
+		Positions[i] = ControlPoint.bPositionIsRelative ? ControlPoint.PositionControlPoint : (ControlPoint.PositionControlPoint - BaseLocation);
+	}
+
+	BuildFromPositions();
+}
+
+void FFollowPathBakedTable::Build(TConstArrayView<FVector> RelativePoints)
+{
+	Reset();
+
+	Positions.Append(RelativePoints.GetData(), RelativePoints.Num());
+
+	BuildFromPositions();
+}
+
+void FFollowPathBakedTable::BuildFromPositions()
+{
+	const int32 NumControlPoints = Positions.Num();
+	if (NumControlPoints == 0)
+	{
+		return;
+	}
+
+	PointTangents.SetNumUninitialized(NumControlPoints);
+	StartPcts.SetNumUninitialized(NumControlPoints);
+	SegmentInvPcts.SetNumUninitialized(NumControlPoints - 1);
+	SegmentDirections.SetNumUninitialized(NumControlPoints - 1);
+	TotalDistance = 0.f;
+
+	// Calculate the distances from point to point, temporarily stashing them in the inverse pct array
+	for (int32 i = 0; i < NumControlPoints - 1; ++i)
+	{
+		const FVector SegmentDelta = Positions[i + 1] - Positions[i];
+		SegmentInvPcts[i] = SegmentDelta.Size();
+		SegmentDirections[i] = SegmentDelta.GetSafeNormal();
+		TotalDistance += SegmentInvPcts[i];
+	}
+
+	// Use the distance to determine what % of time to spend going from each point
+	float Percent = 0.f;
+	for (int32 i = 0; i < NumControlPoints - 1; ++i)
+	{
+		StartPcts[i] = Percent;
 
+		const float SegmentPct = (TotalDistance > 0.f) ? (SegmentInvPcts[i] / TotalDistance) : 0.f;
+		SegmentInvPcts[i] = (SegmentPct > 0.f) ? (1.f / SegmentPct) : 0.f;
+		Percent += SegmentPct;
+	}
+	StartPcts.Last() = 1.f;
+
+	// Calculate the path tangent for each point
+	if (NumControlPoints > 1)
+	{
+		PointTangents[0] = SegmentDirections[0];	// Special case: first point only has 1 influence
+		PointTangents.Last() = SegmentDirections.Last();	// Special case: last point only has 1 influence
+
+		for (int32 i = 1; i < NumControlPoints - 1; ++i)
+		{
+			PointTangents[i] = (SegmentDirections[i - 1] + SegmentDirections[i]).GetSafeNormal();
+		}
+	}
+	else
+	{
+		PointTangents[0] = FVector::ForwardVector;
+	}
+}
+
+int32 FFollowPathBakedTable::FindSegment(float PathPct, int32 HintSegment) const
+{
+	const int32 LastSegment = StartPcts.Num() - 2;
+
+	if (LastSegment < 0)
+	{
+		return INDEX_NONE;
+	}
+
+	if (PathPct >= 1.0f)
+	{
+		return LastSegment;
+	}
+
+	// Most steps stay on the same segment or move onto an adjacent one
+	if (HintSegment >= 0 && HintSegment <= LastSegment)
+	{
+		for (int32 Candidate = FMath::Max(HintSegment - 1, 0); Candidate <= FMath::Min(HintSegment + 1, LastSegment); ++Candidate)
+		{
+			if (StartPcts[Candidate] <= PathPct && PathPct < StartPcts[Candidate + 1])
+			{
+				return Candidate;
+			}
+		}
+	}
+
+	// First point starting after PathPct marks the end of our segment. Zero-length segments are skipped since they share a start pct with their successor.
+	const int32 NextPoint = Algo::UpperBound(StartPcts, PathPct);
+	return FMath::Clamp(NextPoint - 1, 0, LastSegment);
+}
+
+FVector FFollowPathBakedTable::EvaluatePosition(float PathPct, int32 Segment) const
+{
+	if (Segment == INDEX_NONE)
+	{
+		return Positions.IsEmpty() ? FVector::ZeroVector : Positions[0];
+	}
+
+	const float Alpha = FMath::Clamp((PathPct - StartPcts[Segment]) * SegmentInvPcts[Segment], 0.f, 1.f);
+	return FMath::Lerp(Positions[Segment], Positions[Segment + 1], Alpha);
+}
+
+FVector FFollowPathBakedTable::EvaluateInterpolatedTangent(float PathPct, int32 Segment) const
+{
+	if (Segment == INDEX_NONE)
+	{
+		return PointTangents.IsEmpty() ? FVector::ForwardVector : PointTangents[0];
+	}
+
+	if (PathPct <= 0.f)
+	{
+		return PointTangents[0];
+	}
+
+	if (PathPct >= 1.f)
+	{
+		return PointTangents.Last();
+	}
+
+	// Weighted average between the influences of both ends of the segment
+	const float Alpha = FMath::Clamp((PathPct - StartPcts[Segment]) * SegmentInvPcts[Segment], 0.f, 1.f);
+	return FMath::Lerp(PointTangents[Segment], PointTangents[Segment + 1], Alpha).GetSafeNormal();
+}
+
+FVector FFollowPathBakedTable::EvaluateSegmentDirection(float PathPct, int32 Segment) const
+{
+	if (Segment == INDEX_NONE || PathPct >= 1.f)
+	{
+		return FVector::ForwardVector;
+	}
+
+	return SegmentDirections[Segment];
+}
 
 
 UFollowPathMode::UFollowPathMode(const FObjectInitializer& ObjectInitializer)
@@ -34,64 +215,49 @@ void UFollowPathMode::SimulationTick_Implementation(const FSimulationTickParams&
 
 	const float DeltaSeconds = Params.TimeStep.StepMs * 0.001f;
 
+	const FFollowPathBakedTable& BakedPath = GetBakedPath();
+
 	// If we don't already have a valid pathing state, we need to initialize 
 	if (!StartingPathState || !StartingPathState->HasValidPathState())
 	{
-		UpdateControlPoints(true);
-
-		// Indicates we haven't started pathing yet. Finalize control points and capture origins
+		// Indicates we haven't started pathing yet. Capture origins
 		OutputPathState.BaseLocation = UpdatedComponent->GetComponentLocation();
 		OutputPathState.CurrentPathPos = 0.f;
 		OutputPathState.CurrentDirectionMod = 1.f;
+		OutputPathState.CurrentSegment = INDEX_NONE;
+		OutputPathState.BaseLocationAge = 0;
+		OutputPathState.bHasBaseLocation = true;
 
-		if (ControlPoints.Num() > 0)
-		{
-			FInterpControlPoint& StartPoint = ControlPoints[0];
-			StartingLocation = StartPoint.bPositionIsRelative ? OutputPathState.BaseLocation + StartPoint.PositionControlPoint : StartPoint.PositionControlPoint;
-		}
-		else
-		{
-			StartingLocation = UpdatedComponent->GetComponentLocation();
-		}
+		StartingLocation = OutputPathState.BaseLocation + BakedPath.EvaluatePosition(0.f, INDEX_NONE);
 
 		// Move the component to the first path location
 		FHitResult IgnoredHit(1.f);
 		UpdatedComponent->MoveComponent(StartingLocation - OutputPathState.BaseLocation, UpdatedComponent->GetComponentRotation(), false, &IgnoredHit);
-
-		TimeMultiplier = 1.f / Duration;
 	}
-
-	float RemainingSecs = DeltaSeconds;
-
-	while (RemainingSecs > 0.f)
+	else
 	{
-		float StepSecs = RemainingSecs;
-		RemainingSecs -= StepSecs;
-
-		// Compute new time lerp alpha based on how far we moved	
-		float DurationPctRemainder = 0.f;
-		bool bStopped = false;
-		float NewDirectionMod = OutputPathState.CurrentDirectionMod;
-
-		OutputPathState.CurrentPathPos = CalculateNewPathPct(OutputPathState.CurrentPathPos, OutputPathState.CurrentDirectionMod, DeltaSeconds, /* out */ bStopped, /* out */ DurationPctRemainder, /* out */  NewDirectionMod);
+		// A recovered BaseLocation is only as exact as the received path position, so it stays unmarked and is never
+		// compared against the authority's
+		OutputPathState.BaseLocation = FollowPathMode::Utils::Private::GetBaseLocation(OutputPathState, BakedPath, StartingLocation);
+		++OutputPathState.BaseLocationAge;
+	}
 
-		OutputPathState.CurrentDirectionMod = NewDirectionMod;
+	// Find where we end up after the whole step, however many times we loop or bounce along the way
+	bool bStopped = false;
+	float NewDirectionMod = OutputPathState.CurrentDirectionMod;
 
-		// Apply any remaining time
-		if (DurationPctRemainder != 0.f && !bStopped)
-		{
-			RemainingSecs += (DurationPctRemainder * Duration);
-		}
+	OutputPathState.CurrentPathPos = CalculateNewPathPct(OutputPathState.CurrentPathPos, OutputPathState.CurrentDirectionMod, DeltaSeconds, /* out */ bStopped, /* out */ NewDirectionMod);
+	OutputPathState.CurrentDirectionMod = NewDirectionMod;
+	OutputPathState.CurrentSegment = BakedPath.FindSegment(OutputPathState.CurrentPathPos, OutputPathState.CurrentSegment);
 
-		// Compute a move delta to get to that position
-		FVector MoveDelta = ComputeMoveDelta(StartingLocation, OutputPathState.BaseLocation, OutputPathState.CurrentPathPos);
+	// Compute a move delta to get to that position
+	const FVector MoveDelta = ComputeMoveDelta(StartingLocation, OutputPathState.BaseLocation, OutputPathState.CurrentPathPos, OutputPathState.CurrentSegment);
 
-		FRotator DesiredOrientation = ComputeMoveOrientation(OutputPathState.CurrentPathPos, OutputPathState.BaseLocation, UpdatedComponent->GetComponentRotation());
+	const FRotator DesiredOrientation = ComputeMoveOrientation(OutputPathState.CurrentPathPos, OutputPathState.CurrentSegment, UpdatedComponent->GetComponentRotation());
 
-		// Move the object
-		FHitResult IgnoredHit(1.f);
-		UpdatedComponent->MoveComponent(MoveDelta, DesiredOrientation, false, &IgnoredHit);
-	}
+	// Move the object
+	FHitResult IgnoredHit(1.f);
+	UpdatedComponent->MoveComponent(MoveDelta, DesiredOrientation, false, &IgnoredHit);
 
 	// Capture final state
 	FVector Velocity = (UpdatedComponent->GetComponentLocation() - StartingLocation) / DeltaSeconds;
@@ -109,6 +275,37 @@ void UFollowPathMode::SimulationTick_Implementation(const FSimulationTickParams&
 	UpdatedComponent->ComponentVelocity = Velocity;
 }
 
+FTransform UFollowPathMode::EvaluateAtTime(const FMoverSyncState& SyncState, float Seconds) const
+{
+	const FMoverDefaultSyncState* MoveState = SyncState.SyncStateCollection.FindDataByType<FMoverDefaultSyncState>();
+	const FFollowPathState* PathState = SyncState.SyncStateCollection.FindDataByType<FFollowPathState>();
+
+	const FRotator CurrentOrientation = MoveState ? MoveState->GetOrientation_WorldSpace() : FRotator::ZeroRotator;
+	const FVector CurrentLocation = MoveState ? MoveState->GetLocation_WorldSpace() : FVector::ZeroVector;
+
+	const FFollowPathBakedTable& BakedPath = GetBakedPath();
+
+	if (!PathState || !PathState->HasValidPathState() || BakedPath.IsEmpty())
+	{
+		return FTransform(CurrentOrientation, CurrentLocation);
+	}
+
+	// Going back in time is the same as travelling the other way, then facing the original way again
+	const bool bIsQueryingPast = (Seconds < 0.f);
+	const float StartDirectionMod = bIsQueryingPast ? -PathState->CurrentDirectionMod : PathState->CurrentDirectionMod;
+
+	bool bStopped = false;
+	float NewDirectionMod = StartDirectionMod;
+	const float PathPct = AdvancePathPct(BehaviourType, PathState->CurrentPathPos, StartDirectionMod, FMath::Abs(Seconds) / Duration, bStopped, NewDirectionMod);
+
+	const int32 Segment = BakedPath.FindSegment(PathPct, PathState->CurrentSegment);
+	const FVector BaseLocation = FollowPathMode::Utils::Private::GetBaseLocation(*PathState, BakedPath, CurrentLocation);
+	const FVector Location = BaseLocation + BakedPath.EvaluatePosition(PathPct, Segment);
+	const FRotator Orientation = ComputeMoveOrientation(PathPct, Segment, CurrentOrientation);
+
+	return FTransform(Orientation, Location);
+}
+
 void UFollowPathMode::UpdateControlPoints(bool InForceUpdate)
 {
 	const USceneComponent* UpdatedComponent = nullptr;
@@ -132,189 +329,110 @@ void UFollowPathMode::UpdateControlPoints(bool InForceUpdate)
 	{
 		if (InForceUpdate == true)
 		{
-			FVector BasePosition = UpdatedComponent->GetComponentLocation();
-
-			TotalDistance = 0.0f;
-			ControlPointPathTangents.SetNumUninitialized(ControlPoints.Num());
+			InlineBakedPath.Build(ControlPoints, UpdatedComponent->GetComponentLocation());
+		}
+	}
+}
 
-			if (ControlPoints.Num() > 0)
-			{
-				FVector CurrentPos = ControlPoints[0].PositionControlPoint;
-				if (ControlPoints[0].bPositionIsRelative == true)
-				{
-					CurrentPos += BasePosition;
-				}
+const FFollowPathBakedTable& UFollowPathMode::GetBakedPath() const
+{
+	return PathAsset ? PathAsset->GetBakedPath() : InlineBakedPath;
+}
 
-				// Calculate the distances from point to point
-				for (int32 ControlPoint = 0; ControlPoint < ControlPoints.Num(); ControlPoint++)
-				{
-					if (ControlPoint + 1 < ControlPoints.Num())
-					{
-						FVector NextPosition = ControlPoints[ControlPoint + 1].PositionControlPoint;
-						if (ControlPoints[ControlPoint + 1].bPositionIsRelative == true)
-						{
-							NextPosition += BasePosition;
-						}
-						ControlPoints[ControlPoint].DistanceToNext = (NextPosition - CurrentPos).Size();
-
-						TotalDistance += ControlPoints[ControlPoint].DistanceToNext;
-						CurrentPos = NextPosition;
-					}
-					else
-					{
-						ControlPoints[ControlPoint].DistanceToNext = 0.0f;
-						ControlPoints[ControlPoint].Percentage = 1.0f;
-						ControlPoints[ControlPoint].StartTime = 1.0f;
-					}
-				}
-				float Percent = 0.0f;
-				// Use the distance to determine what % of time to spend going from each point
-				for (int32 ControlPoint = 0; ControlPoint < ControlPoints.Num(); ControlPoint++)
-				{
-					ControlPoints[ControlPoint].StartTime = Percent;
-					if (ControlPoints[ControlPoint].DistanceToNext != 0.0f)
-					{
-						ControlPoints[ControlPoint].Percentage = ControlPoints[ControlPoint].DistanceToNext / TotalDistance;
-						Percent += ControlPoints[ControlPoint].Percentage;
-					}
-				}
+void UFollowPathMode::OnRegistered(const FName ModeName)
+{
+	Super::OnRegistered(ModeName);
 
-				// Calculate the path tangent for each point
-				if (ControlPoints.Num() > 1)
-				{
-					for (int32 i = 0; i < ControlPoints.Num(); ++i)
-					{
-						if (i == 0)	// Special case: first point only has 1 influence
-						{
-							ControlPointPathTangents[i] = (ControlPoints[i+1].PositionControlPoint - ControlPoints[i].PositionControlPoint).GetSafeNormal();
-						}
-						else if (i == ControlPoints.Num() - 1)	// Special case: last point only has 1 influence
-						{
-							ControlPointPathTangents[i] = (ControlPoints[i].PositionControlPoint - ControlPoints[i-1].PositionControlPoint).GetSafeNormal();
-						}
-						else
-						{
-							ControlPointPathTangents[i] = ( (ControlPoints[i].PositionControlPoint - ControlPoints[i-1].PositionControlPoint).GetSafeNormal()
-														  + (ControlPoints[i+1].PositionControlPoint - ControlPoints[i].PositionControlPoint).GetSafeNormal() );
-
-							ControlPointPathTangents[i].Normalize();
-						}
-					}
-				}
-				else
-				{
-					ControlPointPathTangents[0] = FVector::ForwardVector;
-				}
-			}
-		}
-	}
+	UpdateControlPoints(true);
 }
 
 
-float UFollowPathMode::CalculateNewPathPct(float InPathPct, float InDirectionMod, float InDeltaSecs, bool& OutStopped, float& OutTimeRemainder, float& OutNewDirectionMod) const
+float UFollowPathMode::CalculateNewPathPct(float InPathPct, float InDirectionMod, float InDeltaSecs, bool& OutStopped, float& OutNewDirectionMod) const
+{
+	return AdvancePathPct(BehaviourType, InPathPct, InDirectionMod, InDeltaSecs / Duration, OutStopped, OutNewDirectionMod);
+}
+
+float UFollowPathMode::AdvancePathPct(EInterpToBehaviourType Behaviour, float InPathPct, float InDirectionMod, float DeltaPct, bool& OutStopped, float& OutNewDirectionMod)
 {
-	OutTimeRemainder = 0.0f;
-	float NewPathPct = InPathPct;
 	OutStopped = false;
 	OutNewDirectionMod = InDirectionMod;
 
-	NewPathPct += ((InDeltaSecs * TimeMultiplier) * InDirectionMod);
-	if (NewPathPct >= 1.0f)
-	{
-		OutTimeRemainder = NewPathPct - 1.0f;
-		if (BehaviourType == EInterpToBehaviourType::OneShot)
-		{
-			NewPathPct = 1.0f;
-			OutStopped = true;
-		}
-		else if (BehaviourType == EInterpToBehaviourType::Loop_Reset)
-		{
-			NewPathPct = 0.0f;
-		}
-		else  // PingPong: reverse direction
-		{
-			OutNewDirectionMod = -InDirectionMod;
-			NewPathPct = 1.0f;
-		}
-	}
-	else if (NewPathPct < 0.0f)
+	const bool bMovingForward = (InDirectionMod >= 0.0f);
+
+	switch (Behaviour)
 	{
-		OutTimeRemainder = -NewPathPct;
-		if (BehaviourType == EInterpToBehaviourType::OneShot_Reverse)
+		case EInterpToBehaviourType::Loop_Reset:
 		{
-			NewPathPct = 0.0f;
-			OutStopped = true;
+			// Every time we pass the end we start over from 0, carrying the remainder
+			return FMath::Frac(InPathPct + (bMovingForward ? DeltaPct : -DeltaPct));
 		}
-		else if (BehaviourType == EInterpToBehaviourType::PingPong)
+
+		case EInterpToBehaviourType::PingPong:
+			// falls through
+		case EInterpToBehaviourType::OneShot_Reverse:
 		{
-			OutNewDirectionMod = -InDirectionMod;
-			NewPathPct = 0.0f;
-		}
-	}
+			// Unfold the back-and-forth motion onto a cycle of length 2: [0,1) is the outbound leg, [1,2) the return leg
+			float CyclePct = (bMovingForward ? InPathPct : (2.0f - InPathPct)) + DeltaPct;
 
-	return NewPathPct;
-}
+			if (Behaviour == EInterpToBehaviourType::OneShot_Reverse && CyclePct >= 2.0f)
+			{
+				OutStopped = true;
+				OutNewDirectionMod = -1.0f;
+				return 0.0f;
+			}
 
+			CyclePct = FMath::Fmod(CyclePct, 2.0f);
 
+			if (CyclePct < 1.0f)
+			{
+				OutNewDirectionMod = 1.0f;
+				return CyclePct;
+			}
 
-FVector UFollowPathMode::ComputeMoveDelta(const FVector CurrentPos, const FVector BaseLocation, const float TargetPathPct) const
-{
-	FVector MoveDelta = FVector::ZeroVector;
-	FVector NewPosition = CurrentPos;
-	//Find current control point
-	float PathPct = 0.0f;
-	int32 CurrentControlPoint = INDEX_NONE;
-	// Always use the end point if we are at the end 
-	if (TargetPathPct >= 1.0f)
-	{
-		CurrentControlPoint = ControlPoints.Num() - 1;
-	}
-	else
-	{
-		for (int32 iSpline = 0; iSpline < ControlPoints.Num(); iSpline++)
+			OutNewDirectionMod = -1.0f;
+			return 2.0f - CyclePct;
+		}
+
+		case EInterpToBehaviourType::OneShot:
+			// falls through
+		default:
 		{
-			float NextTime = PathPct + ControlPoints[iSpline].Percentage;
-			if (TargetPathPct < NextTime)
+			const float NewPathPct = InPathPct + (bMovingForward ? DeltaPct : -DeltaPct);
+			if (NewPathPct >= 1.0f || NewPathPct <= 0.0f)
 			{
-				CurrentControlPoint = iSpline;
-				break;
+				OutStopped = (NewPathPct >= 1.0f) == bMovingForward;
 			}
-			PathPct = NextTime;
+			return FMath::Clamp(NewPathPct, 0.0f, 1.0f);
 		}
 	}
-	// If we found a valid control point get the position between it and the next
-	if (CurrentControlPoint != INDEX_NONE)
-	{
-		float Base = TargetPathPct - ControlPoints[CurrentControlPoint].StartTime;
-		float ThisAlpha = Base / ControlPoints[CurrentControlPoint].Percentage;
-		FVector BeginControlPoint = ControlPoints[CurrentControlPoint].PositionControlPoint + (ControlPoints[CurrentControlPoint].bPositionIsRelative ? BaseLocation : FVector::ZeroVector);
+}
 
-		int32 NextControlPoint = FMath::Clamp(CurrentControlPoint + 1, 0, ControlPoints.Num() - 1);
-		FVector EndControlPoint = ControlPoints[NextControlPoint].PositionControlPoint;
-		EndControlPoint = ControlPoints[NextControlPoint].PositionControlPoint + (ControlPoints[NextControlPoint].bPositionIsRelative ? BaseLocation : FVector::ZeroVector);
 
-		NewPosition = FMath::Lerp(BeginControlPoint, EndControlPoint, ThisAlpha);
-	}
 
-	if (CurrentPos != NewPosition)
+FVector UFollowPathMode::ComputeMoveDelta(const FVector CurrentPos, const FVector BaseLocation, const float TargetPathPct, const int32 Segment) const
+{
+	const FFollowPathBakedTable& BakedPath = GetBakedPath();
+
+	if (BakedPath.IsEmpty())
 	{
-		MoveDelta = NewPosition - CurrentPos;
+		return FVector::ZeroVector;
 	}
-	return MoveDelta;
 
+	const FVector NewPosition = BaseLocation + BakedPath.EvaluatePosition(TargetPathPct, Segment);
+	return NewPosition - CurrentPos;
 }
 
-FRotator UFollowPathMode::ComputeMoveOrientation(const float TargetPathPos, const FVector& BaseLocation, FRotator DefaultOrientation) const
+FRotator UFollowPathMode::ComputeMoveOrientation(const float TargetPathPos, const int32 Segment, FRotator DefaultOrientation) const
 {
 	FRotator ReturnOrientation;
 
 	if (RotationType == EFollowPathRotationType::AlignWithPathTangents)
 	{
-		ReturnOrientation = ComputeInterpolatedTangentFromPathPct(TargetPathPos).ToOrientationRotator();
+		ReturnOrientation = ComputeInterpolatedTangentFromPathPct(TargetPathPos, Segment).ToOrientationRotator();
 	}
 	else if (RotationType == EFollowPathRotationType::AlignWithPath)
 	{
-		ReturnOrientation = ComputeTangentFromPathPct(TargetPathPos, BaseLocation).ToOrientationRotator();
+		ReturnOrientation = ComputeTangentFromPathPct(TargetPathPos, Segment).ToOrientationRotator();
 	}
 	else if (RotationType == EFollowPathRotationType::Fixed)
 	{
@@ -329,100 +447,236 @@ FRotator UFollowPathMode::ComputeMoveOrientation(const float TargetPathPos, cons
 	return ReturnOrientation;
 }
 
-FVector UFollowPathMode::ComputeInterpolatedTangentFromPathPct(const float PathPct) const
+FVector UFollowPathMode::ComputeInterpolatedTangentFromPathPct(const float PathPct, const int32 Segment) const
+{
+	return GetBakedPath().EvaluateInterpolatedTangent(PathPct, Segment);
+}
+
+FVector UFollowPathMode::ComputeTangentFromPathPct(const float PathPct, const int32 Segment) const
+{
+	return GetBakedPath().EvaluateSegmentDirection(PathPct, Segment);
+}
+
+
+#if WITH_EDITOR
+void UFollowPathMode::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
-	if (ControlPoints.IsEmpty())
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	if (ControlPoints.Num() != 0)
 	{
-		return FVector::ForwardVector;
+		UpdateControlPoints(true);
 	}
+}
 
-	FVector InfluenceTangentA(FVector::ForwardVector), InfluenceTangentB(FVector::ForwardVector);
-	float InfluencePctA(0.5f), InfluencePctB(0.5f);
 
-	if (PathPct <= 0.f || ControlPoints.Num() == 1)
-	{
-		InfluenceTangentA = InfluenceTangentB = ControlPointPathTangents[0];
-		InfluencePctA = InfluencePctB = ControlPoints[0].Percentage;
+#endif // WITH_EDITOR
+
 
+
+
+FMoverDataStructBase* FFollowPathState::Clone() const
+{
+	return TMoverDataStructPool<FFollowPathState>::Create(*this);
+}
+
+bool FFollowPathState::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	Super::NetSerialize(Ar, Map, bOutSuccess);
+
+	// BaseLocation only changes when pathing starts, so it's only sent for a few steps after that (and now and then
+	// in case those were all lost). Receivers recover it from the mover's location in the meantime.
+	bool bSendBaseLocation = bHasBaseLocation && ((BaseLocationAge % BaseLocationResendPeriod) < BaseLocationSendSteps);
+	Ar.SerializeBits(&bSendBaseLocation, 1);
+	if (bSendBaseLocation)
+	{
+		Ar << BaseLocation;
 	}
-	else if (PathPct >= 1.f)
+
+	bool bHasPathState = HasValidPathState();
+	Ar.SerializeBits(&bHasPathState, 1);
+
+	// Path position as 16 bit fixed point, direction as a single bit
+	uint16 QuantizedPathPos = static_cast<uint16>(FMath::RoundToInt32(FMath::Clamp(CurrentPathPos, 0.0f, 1.0f) / PathPosQuantum));
+	bool bIsReversed = (CurrentDirectionMod < 0.0f);
+	if (bHasPathState)
 	{
-		InfluenceTangentA = InfluenceTangentB = ControlPointPathTangents[ControlPoints.Num() - 1];
-		InfluencePctA = InfluencePctB = ControlPoints[ControlPoints.Num() - 1].Percentage;
+		Ar << QuantizedPathPos;
+		Ar.SerializeBits(&bIsReversed, 1);
+	}
 
+	if (Ar.IsLoading())
+	{
+		bHasBaseLocation = bSendBaseLocation;
+		CurrentPathPos = bHasPathState ? (QuantizedPathPos * PathPosQuantum) : -1.0f;
+		CurrentDirectionMod = (bHasPathState && bIsReversed) ? -1.0f : 1.0f;
 	}
-	else
+
+	bOutSuccess = true;
+	return true;
+}
+
+
+#if !UE_BUILD_SHIPPING
+namespace FollowPathMode::Utils::Private
+{
+	// Reference implementation matching the original per-call linear scan
+	static int32 FindSegmentLinear(const TArray<float>& StartPcts, float PathPct)
 	{
-		for (int32 i = 0; i < ControlPoints.Num() - 1; ++i)
+		for (int32 i = 0; i < StartPcts.Num() - 1; ++i)
 		{
-			if (PathPct < ControlPoints[i+1].StartTime)
+			if (PathPct < StartPcts[i + 1])
 			{
-				InfluenceTangentA = ControlPointPathTangents[i];
-				InfluencePctA = ControlPoints[i].StartTime;
-
-				InfluenceTangentB = ControlPointPathTangents[i+1];
-				InfluencePctB = ControlPoints[i+1].StartTime;
-				break;
+				return i;
 			}
 		}
+		return StartPcts.Num() - 2;
 	}
 
-
-	// Get the weighted average between influences
-	float TotalWeight = InfluencePctB - InfluencePctA;
-
-	if (FMath::IsNearlyZero(TotalWeight))
+	// Usage: MoverExamples.FollowPath.BenchmarkSegmentLookup [NumSteps]
+	// Simulates a mover walking a path with N evenly spaced control points and times each lookup strategy
+	static void BenchmarkSegmentLookup(const TArray<FString>& Args)
 	{
-		return (InfluenceTangentA + InfluenceTangentB).GetSafeNormal();
-	}
+		const int32 NumSteps = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 100000;
+		const int32 PointCounts[] = { 2, 10, 100, 1000, 10000 };
 
-	FVector InterpolatedTangent = (InfluenceTangentA * (1.f - (FMath::Abs(InfluencePctA - PathPct) / TotalWeight)))
-								+ (InfluenceTangentB * (1.f - (FMath::Abs(InfluencePctB - PathPct) / TotalWeight)));
+		for (const int32 NumPoints : PointCounts)
+		{
+			FFollowPathBakedTable Index;
+			Index.StartPcts.SetNumUninitialized(NumPoints);
+			for (int32 i = 0; i < NumPoints; ++i)
+			{
+				Index.StartPcts[i] = float(i) / float(NumPoints - 1);
+			}
 
-	return InterpolatedTangent.GetSafeNormal();
-}
+			// A looping mover taking one sim step per sample, like FollowPath does in SimulationTick
+			const float PctPerStep = 1.0f / 6000.0f;
+			int32 Checksum = 0;
 
-FVector UFollowPathMode::ComputeTangentFromPathPct(const float PathPct, const FVector& BaseLocation) const
-{
-	if (ControlPoints.Num() > 1)
-	{
-		float PathPctAtNextPoint = 0.f;
+			double StartTime = FPlatformTime::Seconds();
+			for (int32 Step = 0; Step < NumSteps; ++Step)
+			{
+				Checksum += FindSegmentLinear(Index.StartPcts, FMath::Fractional(Step * PctPerStep));
+			}
+			const double LinearMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
 
-		for (int32 i=0; i < ControlPoints.Num()-1; ++i)
-		{
-			PathPctAtNextPoint += ControlPoints[i].Percentage;
-			if (PathPct < PathPctAtNextPoint)
+			StartTime = FPlatformTime::Seconds();
+			for (int32 Step = 0; Step < NumSteps; ++Step)
 			{
-				const FVector FromPos = ControlPoints[i].PositionControlPoint + (ControlPoints[i].bPositionIsRelative ? BaseLocation : FVector::ZeroVector);
-				const FVector ToPos   = ControlPoints[i+1].PositionControlPoint + (ControlPoints[i+1].bPositionIsRelative ? BaseLocation : FVector::ZeroVector);
+				Checksum -= Index.FindSegment(FMath::Fractional(Step * PctPerStep));
+			}
+			const double BinaryMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
 
-				return (ToPos-FromPos).GetSafeNormal();
+			int32 Cursor = INDEX_NONE;
+			StartTime = FPlatformTime::Seconds();
+			for (int32 Step = 0; Step < NumSteps; ++Step)
+			{
+				Cursor = Index.FindSegment(FMath::Fractional(Step * PctPerStep), Cursor);
+				Checksum += Cursor;
 			}
+			const double CursorMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+			UE_LOG(LogMover, Display, TEXT("FollowPath segment lookup: %5d points, %d steps | linear %8.3f ms | binary %8.3f ms | cursor %8.3f ms (checksum %d)"),
+				NumPoints, NumSteps, LinearMs, BinaryMs, CursorMs, Checksum);
 		}
 	}
-	return FVector::ForwardVector;
-}
-
 
-#if WITH_EDITOR
-void UFollowPathMode::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
-{
-	Super::PostEditChangeProperty(PropertyChangedEvent);
+	static FAutoConsoleCommand BenchmarkSegmentLookupCmd(
+		TEXT("MoverExamples.FollowPath.BenchmarkSegmentLookup"),
+		TEXT("Times FollowPath segment lookup strategies (linear scan, binary search, cursor) for 2 to 10k control points. Optional arg: number of steps."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkSegmentLookup));
 
-	if (ControlPoints.Num() != 0)
+	// Reference implementation matching the original full precision NetSerialize
+	static void SerializeFollowPathStateLegacy(FArchive& Ar, FFollowPathState& State)
 	{
-		UpdateControlPoints(true);
+		Ar << State.BaseLocation;
+		Ar << State.CurrentPathPos;
+		Ar << State.CurrentDirectionMod;
 	}
-}
 
+	// Usage: MoverExamples.FollowPath.BenchmarkNetSerialize [NumClients] [NumFrames]
+	// Serializes a looping platform's state to every client each frame, in the original format and the current one,
+	// and reports the size and time taken of each
+	static void BenchmarkNetSerialize(const TArray<FString>& Args)
+	{
+		const int32 NumClients = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 100;
+		const int32 NumFrames = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 600;
+		const float PathPctPerFrame = 1.0f / 300.0f;
+
+		FFollowPathState State;
+		State.BaseLocation = FVector(1234.5, -678.25, 250.0);
+		State.CurrentDirectionMod = 1.0f;
 
-#endif // WITH_EDITOR
+		int64 LegacyBits = 0;
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			State.CurrentPathPos = FMath::Fractional(Frame * PathPctPerFrame);
+			for (int32 Client = 0; Client < NumClients; ++Client)
+			{
+				FNetBitWriter Writer(nullptr, 512);
+				SerializeFollowPathStateLegacy(Writer, State);
+				LegacyBits += Writer.GetNumBits();
+			}
+		}
+		const double LegacyMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		// A received state without BaseLocation has to recover it from the mover's location, mid-path and with no segment
+		FFollowPathBakedTable BakedPath;
+		const FVector PathPoints[] = { FVector::ZeroVector, FVector(1000.0, 0.0, 0.0), FVector(1000.0, 2000.0, 0.0), FVector(-500.0, 2000.0, 800.0) };
+		BakedPath.Build(PathPoints);
+
+		int64 QuantizedBits = 0;
+		float MaxPathPosError = 0.0f;
+		double MaxBaseLocationError = 0.0;
+		int32 NumRecoveredBaseLocations = 0;
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			State.CurrentPathPos = FMath::Fractional(Frame * PathPctPerFrame);
+			State.BaseLocationAge = static_cast<uint8>(Frame);
+			for (int32 Client = 0; Client < NumClients; ++Client)
+			{
+				FNetBitWriter Writer(nullptr, 512);
+				bool bSuccess = false;
+				State.NetSerialize(Writer, nullptr, bSuccess);
+				QuantizedBits += Writer.GetNumBits();
 
+				if (Client == 0)
+				{
+					FNetBitReader Reader(nullptr, Writer.GetData(), Writer.GetNumBits());
+					FFollowPathState Received;
+					Received.NetSerialize(Reader, nullptr, bSuccess);
+					MaxPathPosError = FMath::Max(MaxPathPosError, FMath::Abs(Received.CurrentPathPos - State.CurrentPathPos));
+
+					if (!Received.bHasBaseLocation)
+					{
+						const FVector MoverLocation = State.BaseLocation + BakedPath.EvaluatePosition(Received.CurrentPathPos, BakedPath.FindSegment(Received.CurrentPathPos));
+						const FVector RecoveredBaseLocation = GetBaseLocation(Received, BakedPath, MoverLocation);
+						MaxBaseLocationError = FMath::Max(MaxBaseLocationError, FVector::Dist(RecoveredBaseLocation, State.BaseLocation));
+						++NumRecoveredBaseLocations;
+					}
+				}
+			}
+		}
+		const double QuantizedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
 
+		const double NumStates = double(NumClients) * NumFrames;
+		UE_LOG(LogMover, Display, TEXT("FollowPath NetSerialize: %d clients, %d frames | legacy %.1f bits/state, %.1f bytes/frame, %8.3f ms | quantized %.1f bits/state, %.1f bytes/frame, %8.3f ms (max path pos error %.6f)"),
+			NumClients, NumFrames,
+			LegacyBits / NumStates, LegacyBits / (8.0 * NumFrames), LegacyMs,
+			QuantizedBits / NumStates, QuantizedBits / (8.0 * NumFrames), QuantizedMs,
+			MaxPathPosError);
 
+		if (MaxBaseLocationError > UE_KINDA_SMALL_NUMBER)
+		{
+			UE_LOG(LogMover, Error, TEXT("FollowPath NetSerialize: base location recovered %d times, off by up to %.3f"), NumRecoveredBaseLocations, MaxBaseLocationError);
+		}
+	}
 
-FMoverDataStructBase* FFollowPathState::Clone() const
-{
-	FFollowPathState* CopyPtr = new FFollowPathState(*this);
-	return CopyPtr;
+	static FAutoConsoleCommand BenchmarkNetSerializeCmd(
+		TEXT("MoverExamples.FollowPath.BenchmarkNetSerialize"),
+		TEXT("Compares the size and speed of the original and quantized FollowPath state serialization. Optional args: number of clients and frames."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkNetSerialize));
 }
+#endif // !UE_BUILD_SHIPPING
@@ -6,6 +6,10 @@
 #include "MoveLibrary/MovementUtils.h"
 #include "Components/SplineComponent.h"
 #include "Curves/CurveFloat.h"
+#include "Misc/ScopeRWLock.h"
+#include "HAL/IConsoleManager.h"
+#include "MoverLog.h"
+#include "UObject/CoreNet.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FollowSplineMode)
 
@@ -36,6 +40,101 @@ namespace FollowSplineMode::Utils::Private
 		}
 		return 0.0f;
 	}
+
+	// Modulo that always lands in [0, Period), for wrapping looping follow times in either direction
+	static float WrapTime(float Time, float Period)
+	{
+		if (Period <= 0.0f)
+		{
+			return 0.0f;
+		}
+
+		const float Wrapped = FMath::Fmod(Time, Period);
+		return (Wrapped < 0.0f) ? (Wrapped + Period) : Wrapped;
+	}
+}
+
+
+void FFollowSplineBakedTable::Build(const USplineComponent& Spline, bool bUseConstantVelocity, float Tolerance, int32 MaxSamples)
+{
+	SourceSpline = &Spline;
+	SourceSplineVersion = Spline.SplineCurves.Version;
+	bSourceConstantVelocity = bUseConstantVelocity;
+	SourceTolerance = Tolerance;
+	SplineDuration = Spline.Duration;
+
+	MaxSamples = FMath::Max(MaxSamples, 2);
+	int32 NumIntervals = FMath::Clamp(Spline.GetNumberOfSplinePoints() * 8, 1, MaxSamples - 1);
+
+	while (true)
+	{
+		const float SampleInterval = SplineDuration / NumIntervals;
+
+		Locations.SetNumUninitialized(NumIntervals + 1);
+		Rotations.SetNumUninitialized(NumIntervals + 1);
+		Tangents.SetNumUninitialized(NumIntervals + 1);
+
+		for (int32 i = 0; i <= NumIntervals; ++i)
+		{
+			const float SplineTime = (i == NumIntervals) ? SplineDuration : (i * SampleInterval);
+			const FTransform SampleTransform = Spline.GetTransformAtTime(SplineTime, ESplineCoordinateSpace::Local, bUseConstantVelocity);
+
+			Locations[i] = SampleTransform.GetLocation();
+			Rotations[i] = SampleTransform.GetRotation();
+			Tangents[i] = Spline.GetTangentAtTime(SplineTime, ESplineCoordinateSpace::Local, bUseConstantVelocity);
+
+			// Keep neighboring rotations in the same hemisphere so blending between them takes the short way around
+			if (i > 0 && (Rotations[i] | Rotations[i - 1]) < 0.0f)
+			{
+				Rotations[i] = -Rotations[i];
+			}
+		}
+
+		// Worst case error is usually halfway between samples
+		MaxError = 0.0f;
+		for (int32 i = 0; i < NumIntervals; ++i)
+		{
+			const FVector ActualLocation = Spline.GetLocationAtTime((i + 0.5f) * SampleInterval, ESplineCoordinateSpace::Local, bUseConstantVelocity);
+			MaxError = FMath::Max(MaxError, FVector::Dist(ActualLocation, FMath::Lerp(Locations[i], Locations[i + 1], 0.5f)));
+		}
+
+		if (MaxError <= Tolerance || NumIntervals + 1 >= MaxSamples)
+		{
+			break;
+		}
+
+		NumIntervals = FMath::Min(NumIntervals * 2, MaxSamples - 1);
+	}
+
+	InvSampleInterval = (SplineDuration > 0.0f) ? (NumIntervals / SplineDuration) : 0.0f;
+
+	UE_CLOG(MaxError > Tolerance, LogMover, Warning, TEXT("Baked spline %s is %.2f off from the source spline, over the tolerance of %.2f. Consider raising MaxBakedSplineSamples."),
+		*GetPathNameSafe(&Spline), MaxError, Tolerance);
+}
+
+bool FFollowSplineBakedTable::IsUpToDate(const USplineComponent& Spline, bool bUseConstantVelocity, float Tolerance) const
+{
+	return SourceSpline.Get() == &Spline
+		&& SourceSplineVersion == Spline.SplineCurves.Version
+		&& SplineDuration == Spline.Duration
+		&& bSourceConstantVelocity == bUseConstantVelocity
+		&& SourceTolerance == Tolerance;
+}
+
+void FFollowSplineBakedTable::Sample(float SplineTime, FVector& OutLocation, FQuat& OutRotation, FVector* OutTangent) const
+{
+	const int32 LastSample = Locations.Num() - 1;
+	const float SampleIndex = FMath::Clamp(SplineTime * InvSampleInterval, 0.0f, float(LastSample));
+	const int32 Index = FMath::Min(FMath::FloorToInt32(SampleIndex), LastSample - 1);
+	const float Alpha = SampleIndex - Index;
+
+	OutLocation = FMath::Lerp(Locations[Index], Locations[Index + 1], Alpha);
+	OutRotation = FQuat::FastLerp(Rotations[Index], Rotations[Index + 1], Alpha).GetNormalized();
+
+	if (OutTangent)
+	{
+		*OutTangent = FMath::Lerp(Tangents[Index], Tangents[Index + 1], Alpha);
+	}
 }
 
 
@@ -74,57 +173,22 @@ void UFollowSplineMode::SimulationTick_Implementation(const FSimulationTickParam
 		return;
 	}
 
-	// Initilization
-	StartReversedMultiplier = StartReveresed ? -1 : 1;
-	StartOffsetSeconds = FollowSplineMode::Utils::Private::ComputeRangeInputValue(ControlSpline, StartOffset);
-	EndOffsetSeconds = FollowSplineMode::Utils::Private::ComputeRangeInputValue(ControlSpline, EndOffset);
-
-	// Using strictly less than to avoid divide by zero exceptions. Otherwise FollowDuration would become zero.
-	if (!ensureMsgf(StartOffsetSeconds < EndOffsetSeconds, TEXT("StartOffset should be less than EndOffset. To reverse the direction use the bSplineFollowDirection property. Aborting.")))
+	FFollowSplineRange Range;
+	if (!ensureMsgf(ComputeFollowRange(Range), TEXT("StartOffset should be less than EndOffset. To reverse the direction use the bSplineFollowDirection property. Aborting.")))
 	{
 		return;
 	}
 
-	FollowDuration = EndOffsetSeconds - StartOffsetSeconds;
-	// Retrieve the data from the SplineState
-	if (!StartingPathState || 
-		(StartingPathState && StartingPathState->CurrentSplineTime == -1.0f)) // Uninitialized, use the current offset if set.
-	{
-		CurrentSplineTime +=  DeltaSeconds;
-	}
-	else
-	{
-		CurrentSplineTime = StartingPathState->CurrentSplineTime + DeltaSeconds;
-		FollowDirectionMultiplier = StartingPathState->CurrentDirectionMultiplier;
-	}
-		
-	float MeasuredSplineTime = CurrentSplineTime;
-
-	// Apply Interpolation Curve based speed control
-	if (InterpolationCurve)
-	{
-		const float CurrentSplinePct = FMath::Clamp(MeasuredSplineTime / FollowDuration, 0.0f, 1.0f);
-		MeasuredSplineTime = FollowDuration * FMath::Clamp(InterpolationCurve->GetFloatValue(CurrentSplinePct), 0.0f,1.0f);
-	}
-	
-	// Apply custom duration for follow motion
-	float CustomFollowDuration = FollowDuration;
-	if (CustomDurationSecondsOverride > 0.0f)
-	{
-		CustomFollowDuration = CustomDurationSecondsOverride;
-	}
-
-	// Move the relative time to offset time frame.
-	const float MappedSplineTime = FMath::GetMappedRangeValueClamped(
-		FVector2f(0.0f, 2.0f * CustomFollowDuration),
-		FVector2f(StartOffsetSeconds, EndOffsetSeconds + FollowDuration), 
-		MeasuredSplineTime);
+	// Retrieve the data from the SplineState. Uninitialized states start from the configured initial offset.
+	const bool bIsStateInitialized = StartingPathState && StartingPathState->CurrentSplineTime != -1.0f;
+	const float NewSplineTime = AdvanceSplineTime(Range, bIsStateInitialized ? StartingPathState->CurrentSplineTime : InitialSplineTime, DeltaSeconds);
 
+	FTransform SplineTransform;
+	int32 NewDirectionMultiplier = 1;
 
-	if (CanMove(MappedSplineTime))
+	if (SampleTransformAtSplineTime(Range, NewSplineTime, MovingComps.UpdatedComponent->GetComponentRotation(), SplineTransform, NewDirectionMultiplier))
 	{
 		// Move the object
-		const FTransform SplineTransform = GetTransformAtTime(MappedSplineTime, MovingComps.UpdatedComponent->GetComponentRotation());
 		const FVector MoveDelta = SplineTransform.GetLocation() - StartingLocation;
 		const FVector Velocity = DeltaSeconds > UE_SMALL_NUMBER ? MoveDelta / DeltaSeconds : FVector::ZeroVector;
 
@@ -135,7 +199,9 @@ void UFollowSplineMode::SimulationTick_Implementation(const FSimulationTickParam
 		
 		UMovementUtils::TrySafeMoveUpdatedComponent(MovingComps, MoveDelta, SplineTransform.GetRotation(), true, MoveHitResult, ETeleportType::None, MoveRecord);
 
-		UpdatePathState(OutputPathState);
+		OutputPathState.CurrentSplineTime = NewSplineTime;
+		OutputPathState.CurrentDirectionMultiplier = NewDirectionMultiplier;
+
 		FRotator NewRotation = MovingComps.UpdatedComponent->GetComponentRotation();
 		FVector AngularVelocityDegrees = UMovementUtils::ComputeAngularVelocityDegrees(StartingOrientation, NewRotation, DeltaSeconds);
 		
@@ -154,12 +220,13 @@ void UFollowSplineMode::SetControlSpline(const AActor* SplineProviderActor, FSpl
 	{
 		using namespace FollowSplineMode::Utils::Private;
 		ControlSpline = SplineComponent;
-		
-		const float StartOffsetTime = ComputeRangeInputValue(ControlSpline, StartOffset);
-		const float EndOffsetTime = ComputeRangeInputValue(ControlSpline, EndOffset);
-		const float InitialOffsetTime = ComputeRangeInputValue(ControlSpline, Offset);
 
-		CurrentSplineTime = FMath::Clamp(InitialOffsetTime, StartOffsetTime, EndOffsetTime) - StartOffsetTime;
+		// Also primes the range cache, so the first tick on the new spline doesn't pay for it
+		FFollowSplineRange Range;
+		ComputeFollowRange(Range);
+
+		const float InitialOffsetTime = ComputeRangeInputValue(ControlSpline, Offset);
+		InitialSplineTime = FMath::Clamp(InitialOffsetTime, Range.StartOffsetSeconds, Range.EndOffsetSeconds) - Range.StartOffsetSeconds;
 	}
 }
 
@@ -168,6 +235,70 @@ void UFollowSplineMode::OnRegistered(const FName ModeName)
 	Super::OnRegistered(ModeName);
 
 	ConfigureSplineData();
+
+	// Bake up front rather than on the first simulation tick
+	if (bUseBakedSpline)
+	{
+		GetBakedSpline();
+	}
+
+	if (bUseBakedInterpolationCurve)
+	{
+		GetBakedInterpolationCurve();
+	}
+}
+
+TSharedPtr<const FFollowSplineBakedTable, ESPMode::ThreadSafe> UFollowSplineMode::GetBakedSpline() const
+{
+	if (!ControlSpline)
+	{
+		return nullptr;
+	}
+
+	{
+		FReadScopeLock ReadLock(DerivedDataLock);
+		if (BakedSpline.IsValid() && BakedSpline->IsUpToDate(*ControlSpline, bConstantFollowVelocity, BakedSplineTolerance))
+		{
+			return BakedSpline;
+		}
+	}
+
+	FWriteScopeLock WriteLock(DerivedDataLock);
+
+	// Someone else may have rebaked while we waited for the lock
+	if (!BakedSpline.IsValid() || !BakedSpline->IsUpToDate(*ControlSpline, bConstantFollowVelocity, BakedSplineTolerance))
+	{
+		TSharedPtr<FFollowSplineBakedTable, ESPMode::ThreadSafe> NewTable = MakeShared<FFollowSplineBakedTable, ESPMode::ThreadSafe>();
+		NewTable->Build(*ControlSpline, bConstantFollowVelocity, BakedSplineTolerance, MaxBakedSplineSamples);
+		BakedSpline = NewTable;
+	}
+
+	return BakedSpline;
+}
+
+TSharedPtr<const FBakedCurveFloat, ESPMode::ThreadSafe> UFollowSplineMode::GetBakedInterpolationCurve() const
+{
+	if (!InterpolationCurve)
+	{
+		return nullptr;
+	}
+
+	const uint32 CurrentGeneration = FBakedCurveFloat::GetCurrentGeneration();
+
+	{
+		FReadScopeLock ReadLock(DerivedDataLock);
+		if (BakedInterpolationCurve.IsValid() && BakedInterpolationCurve->SourceCurve.Get() == InterpolationCurve && BakedInterpolationCurveGeneration == CurrentGeneration)
+		{
+			return BakedInterpolationCurve;
+		}
+	}
+
+	TSharedPtr<const FBakedCurveFloat, ESPMode::ThreadSafe> Table = FBakedCurveFloat::FindOrBake(InterpolationCurve);
+
+	FWriteScopeLock WriteLock(DerivedDataLock);
+	BakedInterpolationCurve = Table;
+	BakedInterpolationCurveGeneration = CurrentGeneration;
+	return Table;
 }
 
 void UFollowSplineMode::ConfigureSplineData()
@@ -194,116 +325,209 @@ void UFollowSplineMode::ConfigureSplineData()
 	}
 }
 
-FTransform UFollowSplineMode::GetTransformAtTime(float MeasuredSplineTime, const FRotator& DefaultOrientation)
+FTransform UFollowSplineMode::EvaluateAtTime(const FMoverSyncState& SyncState, float Seconds) const
 {
-	const float BehaviorSplineTime = ApplyBehaviorType(MeasuredSplineTime);
-	const float DirectionSplineTime = ApplyFollowDirection(BehaviorSplineTime);
+	const FMoverDefaultSyncState* MoveState = SyncState.SyncStateCollection.FindDataByType<FMoverDefaultSyncState>();
+	const FFollowSplineState* PathState = SyncState.SyncStateCollection.FindDataByType<FFollowSplineState>();
 
-	FTransform SplineTransform = ControlSpline->GetTransformAtTime(DirectionSplineTime, ESplineCoordinateSpace::World, bConstantFollowVelocity);
-	if (RotationType == EFollowSplineRotationType::NoRotation)
+	const FRotator CurrentOrientation = MoveState ? MoveState->GetOrientation_WorldSpace() : FRotator::ZeroRotator;
+	const FTransform CurrentTransform(CurrentOrientation, MoveState ? MoveState->GetLocation_WorldSpace() : FVector::ZeroVector);
+
+	FFollowSplineRange Range;
+	if (!ComputeFollowRange(Range))
 	{
-		const FQuat RotationQuat(DefaultOrientation);
-		SplineTransform.SetRotation(RotationQuat);
+		return CurrentTransform;
 	}
-	else if (bOrientMoverToMovement)
+
+	const bool bIsStateInitialized = PathState && PathState->CurrentSplineTime != -1.0f;
+	const float SplineTime = AdvanceSplineTime(Range, bIsStateInitialized ? PathState->CurrentSplineTime : InitialSplineTime, Seconds);
+
+	FTransform SplineTransform;
+	int32 DirectionMultiplier = 1;
+	if (!SampleTransformAtSplineTime(Range, SplineTime, CurrentOrientation, SplineTransform, DirectionMultiplier))
 	{
-		const FVector Tangent = FMath::Sign(OrientationMultiplier * FollowDirectionMultiplier * StartReversedMultiplier) * ControlSpline->GetTangentAtTime(DirectionSplineTime, ESplineCoordinateSpace::World, bConstantFollowVelocity);
-		const FQuat Orientation = Tangent.ToOrientationQuat();
-		SplineTransform.SetRotation(Orientation);
+		// Outside the followed range, the mover stays wherever it stopped
+		return CurrentTransform;
 	}
 
 	return SplineTransform;
 }
 
-float UFollowSplineMode::ApplyBehaviorType(float MeasuredSplineTime)
+FFollowSplineRangeStamp UFollowSplineMode::MakeRangeStamp() const
 {
-	switch (BehaviourType)
+	FFollowSplineRangeStamp Stamp;
+	Stamp.Spline = ControlSpline;
+	Stamp.SplineVersion = ControlSpline ? ControlSpline->SplineCurves.Version : 0;
+	Stamp.SplineDuration = ControlSpline ? ControlSpline->Duration : 0.0f;
+	Stamp.StartOffset = StartOffset;
+	Stamp.EndOffset = EndOffset;
+	Stamp.CustomDurationSecondsOverride = CustomDurationSecondsOverride;
+	return Stamp;
+}
+
+bool UFollowSplineMode::ComputeFollowRange(FFollowSplineRange& OutRange) const
+{
+	using namespace FollowSplineMode::Utils::Private;
+
+	if (!ControlSpline)
 	{
-	case EInterpToBehaviourType::OneShot_Reverse:
+		return false;
+	}
+
+	const FFollowSplineRangeStamp Stamp = MakeRangeStamp();
+
 	{
-		MeasuredSplineTime = EndOffsetSeconds - MeasuredSplineTime + StartOffsetSeconds;
-		if (MeasuredSplineTime >= EndOffsetSeconds)
+		FReadScopeLock ReadLock(DerivedDataLock);
+		if (bHasCachedRange && CachedRangeStamp == Stamp)
 		{
-			MeasuredSplineTime = EndOffsetSeconds;
+			OutRange = CachedRange;
+			return bIsCachedRangeValid;
 		}
+	}
 
-		if (bOrientMoverToMovement)
-		{
-			OrientationMultiplier = -1;
-		}
-		else
-		{
-			OrientationMultiplier = 1;
-		}
-		break;
+	FFollowSplineRange NewRange;
+	NewRange.StartOffsetSeconds = ComputeRangeInputValue(ControlSpline, StartOffset);
+	NewRange.EndOffsetSeconds = ComputeRangeInputValue(ControlSpline, EndOffset);
+
+	// Using strictly less than to avoid divide by zero exceptions. Otherwise FollowDuration would become zero.
+	const bool bIsValidRange = (NewRange.StartOffsetSeconds < NewRange.EndOffsetSeconds);
+	if (bIsValidRange)
+	{
+		NewRange.FollowDuration = NewRange.EndOffsetSeconds - NewRange.StartOffsetSeconds;
+		NewRange.CycleDuration = (CustomDurationSecondsOverride > 0.0f) ? CustomDurationSecondsOverride : NewRange.FollowDuration;
+	}
+
+	{
+		FWriteScopeLock WriteLock(DerivedDataLock);
+		CachedRange = NewRange;
+		CachedRangeStamp = Stamp;
+		bIsCachedRangeValid = bIsValidRange;
+		bHasCachedRange = true;
 	}
+
+	OutRange = NewRange;
+	return bIsValidRange;
+}
+
+float UFollowSplineMode::AdvanceSplineTime(const FFollowSplineRange& Range, float SplineTime, float DeltaSeconds) const
+{
+	using namespace FollowSplineMode::Utils::Private;
+
+	const float NewSplineTime = SplineTime + DeltaSeconds;
+
+	switch (BehaviourType)
+	{
 	case EInterpToBehaviourType::Loop_Reset:
 	{
-		if (MeasuredSplineTime >= EndOffsetSeconds)
-		{
-			MeasuredSplineTime = StartOffsetSeconds;
-			CurrentSplineTime = 0.0f;
-		}
-		break;
+		// Start over each time we reach the end, keeping any leftover time
+		return WrapTime(NewSplineTime, Range.CycleDuration);
 	}
 	case EInterpToBehaviourType::PingPong:
 	{
-		if (MeasuredSplineTime >= EndOffsetSeconds)
-		{
-			FollowDirectionMultiplier = -1;
-		}
-
-		if (MeasuredSplineTime >= EndOffsetSeconds + FollowDuration)
-		{
-			bResetPingPong = true;
-		}
+		// The way there and back takes twice the cycle duration
+		return WrapTime(NewSplineTime, 2.0f * Range.CycleDuration);
 	}
+	case EInterpToBehaviourType::OneShot_Reverse:
+		// falls through
 	case EInterpToBehaviourType::OneShot:
 		// falls through
 	default:
 		break;
 	}
 
-	return MeasuredSplineTime;
+	return FMath::Max(NewSplineTime, 0.0f);
 }
 
-float UFollowSplineMode::ApplyFollowDirection(float MeasuredSplineTime)
+bool UFollowSplineMode::SampleTransformAtSplineTime(const FFollowSplineRange& Range, float SplineTime, const FRotator& DefaultOrientation, FTransform& OutTransform, int32& OutDirectionMultiplier) const
 {
-	// Wrap the time around as ping pong mode maps the motion to twice the duration
-	while (MeasuredSplineTime < StartOffsetSeconds)
+	const float RangeStart = Range.StartOffsetSeconds;
+	const float RangeEnd = Range.EndOffsetSeconds;
+
+	float MeasuredSplineTime = SplineTime;
+
+	// Apply Interpolation Curve based speed control
+	if (InterpolationCurve)
 	{
-		MeasuredSplineTime += FollowDuration;
+		const float CurrentSplinePct = FMath::Clamp(MeasuredSplineTime / Range.FollowDuration, 0.0f, 1.0f);
+
+		TSharedPtr<const FBakedCurveFloat, ESPMode::ThreadSafe> BakedCurve = bUseBakedInterpolationCurve ? GetBakedInterpolationCurve() : nullptr;
+		const float CurveValue = BakedCurve.IsValid() ? BakedCurve->Evaluate(CurrentSplinePct) : InterpolationCurve->GetFloatValue(CurrentSplinePct);
+		MeasuredSplineTime = Range.FollowDuration * FMath::Clamp(CurveValue, 0.0f, 1.0f);
 	}
-	while (MeasuredSplineTime > EndOffsetSeconds)
+
+	// Move the relative time to offset time frame. The second half of the mapped range is the way back for ping pong.
+	float MappedSplineTime = FMath::GetMappedRangeValueClamped(
+		FVector2f(0.0f, 2.0f * Range.CycleDuration),
+		FVector2f(RangeStart, RangeEnd + Range.FollowDuration),
+		MeasuredSplineTime);
+
+	OutDirectionMultiplier = 1;
+
+	if (!CanMove(Range, MappedSplineTime))
 	{
-		MeasuredSplineTime -= FollowDuration;
+		return false;
 	}
 
-	// Apply the final directional inversion
-	if (FMath::Sign(FollowDirectionMultiplier * StartReversedMultiplier) < 0)
+	// Apply the behavior type. Looping behaviors already wrapped the accumulated time, so only the direction changes here.
+	int32 OrientationSign = 1;
+	if (BehaviourType == EInterpToBehaviourType::OneShot_Reverse)
 	{
-		MeasuredSplineTime = EndOffsetSeconds - MeasuredSplineTime + StartOffsetSeconds;
+		MappedSplineTime = FMath::Min(RangeEnd - MappedSplineTime + RangeStart, RangeEnd);
+		OrientationSign = bOrientMoverToMovement ? -1 : 1;
+	}
+	else if (BehaviourType == EInterpToBehaviourType::PingPong && MappedSplineTime >= RangeEnd)
+	{
+		OutDirectionMultiplier = -1;
 	}
-	
-	return MeasuredSplineTime;
-}
 
-void UFollowSplineMode::UpdatePathState(FFollowSplineState& OutputPathState)
-{
-	if (bResetPingPong)
+	// Wrap the time around as ping pong mode maps the motion to twice the duration, then apply the final directional inversion
+	if (MappedSplineTime < RangeStart || MappedSplineTime > RangeEnd)
+	{
+		MappedSplineTime = RangeStart + FollowSplineMode::Utils::Private::WrapTime(MappedSplineTime - RangeStart, Range.FollowDuration);
+	}
+
+	const int32 StartSign = StartReveresed ? -1 : 1;
+	if (OutDirectionMultiplier * StartSign < 0)
 	{
-		OutputPathState.CurrentSplineTime = 0.0f;
-		OutputPathState.CurrentDirectionMultiplier = 1;	
-		bResetPingPong = false;
+		MappedSplineTime = RangeEnd - MappedSplineTime + RangeStart;
+	}
+
+	const bool bNeedsTangent = (RotationType != EFollowSplineRotationType::NoRotation) && bOrientMoverToMovement;
+	FVector SplineTangent = FVector::ForwardVector;
+
+	if (const TSharedPtr<const FFollowSplineBakedTable, ESPMode::ThreadSafe> BakedTable = bUseBakedSpline ? GetBakedSpline() : nullptr)
+	{
+		FVector LocalLocation;
+		FQuat LocalRotation;
+		BakedTable->Sample(MappedSplineTime, LocalLocation, LocalRotation, bNeedsTangent ? &SplineTangent : nullptr);
+
+		const FTransform& SplineToWorld = ControlSpline->GetComponentTransform();
+		OutTransform = FTransform(SplineToWorld.GetRotation() * LocalRotation, SplineToWorld.TransformPosition(LocalLocation));
+		SplineTangent = SplineToWorld.TransformVector(SplineTangent);
 	}
 	else
 	{
-		OutputPathState.CurrentSplineTime = CurrentSplineTime;
-		OutputPathState.CurrentDirectionMultiplier = FollowDirectionMultiplier;
+		OutTransform = ControlSpline->GetTransformAtTime(MappedSplineTime, ESplineCoordinateSpace::World, bConstantFollowVelocity);
+		if (bNeedsTangent)
+		{
+			SplineTangent = ControlSpline->GetTangentAtTime(MappedSplineTime, ESplineCoordinateSpace::World, bConstantFollowVelocity);
+		}
+	}
+
+	if (RotationType == EFollowSplineRotationType::NoRotation)
+	{
+		OutTransform.SetRotation(FQuat(DefaultOrientation));
+	}
+	else if (bOrientMoverToMovement)
+	{
+		const FVector Tangent = float(OrientationSign * OutDirectionMultiplier * StartSign) * SplineTangent;
+		OutTransform.SetRotation(Tangent.ToOrientationQuat());
 	}
+
+	return true;
 }
 
-bool UFollowSplineMode::CanMove(float MeasuredSplineTime) const
+bool UFollowSplineMode::CanMove(const FFollowSplineRange& Range, float MappedSplineTime) const
 {
 	switch (BehaviourType)
 	{
@@ -321,11 +545,96 @@ bool UFollowSplineMode::CanMove(float MeasuredSplineTime) const
 		break;
 	}
 
-	return  (StartOffsetSeconds <= MeasuredSplineTime) && (MeasuredSplineTime <= EndOffsetSeconds);
+	return  (Range.StartOffsetSeconds <= MappedSplineTime) && (MappedSplineTime <= Range.EndOffsetSeconds);
 }
 
 FMoverDataStructBase* FFollowSplineState::Clone() const
 {
-	FFollowSplineState* CopyPtr = new FFollowSplineState(*this);
-	return CopyPtr;
+	return TMoverDataStructPool<FFollowSplineState>::Create(*this);
+}
+
+bool FFollowSplineState::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	Super::NetSerialize(Ar, Map, bOutSuccess);
+
+	// Spline time as a whole number of quanta, packed so shorter follow durations take fewer bytes. Only sent once
+	// the state has been initialized.
+	bool bIsInitialized = (CurrentSplineTime >= 0.0f);
+	Ar.SerializeBits(&bIsInitialized, 1);
+
+	bool bIsReversed = (CurrentDirectionMultiplier < 0);
+	Ar.SerializeBits(&bIsReversed, 1);
+
+	uint32 QuantizedSplineTime = bIsInitialized ? static_cast<uint32>(FMath::RoundToInt64(CurrentSplineTime / NetTimeQuantum)) : 0;
+	if (bIsInitialized)
+	{
+		Ar.SerializeIntPacked(QuantizedSplineTime);
+	}
+
+	if (Ar.IsLoading())
+	{
+		CurrentSplineTime = bIsInitialized ? (QuantizedSplineTime * NetTimeQuantum) : -1.0f;
+		CurrentDirectionMultiplier = bIsReversed ? -1 : 1;
+	}
+
+	bOutSuccess = true;
+	return true;
+}
+
+#if !UE_BUILD_SHIPPING
+namespace FollowSplineMode::Utils::Private
+{
+	// Reference implementation matching the original full precision NetSerialize
+	static void SerializeFollowSplineStateLegacy(FArchive& Ar, FFollowSplineState& State)
+	{
+		Ar << State.CurrentSplineTime;
+		Ar << State.CurrentDirectionMultiplier;
+	}
+
+	// Usage: MoverExamples.FollowSpline.BenchmarkNetSerialize [FollowDurationSeconds] [SendRateHz]
+	// Serializes a ping-ponging mover's state over one full cycle, in the original format and the current one, and
+	// reports the bandwidth each takes per mover
+	static void BenchmarkNetSerialize(const TArray<FString>& Args)
+	{
+		const float FollowDuration = Args.Num() > 0 ? FMath::Max(0.1f, FCString::Atof(*Args[0])) : 10.0f;
+		const float SendRate = Args.Num() > 1 ? FMath::Max(1.0f, FCString::Atof(*Args[1])) : 30.0f;
+		const int32 NumSends = FMath::Max(1, FMath::CeilToInt32(2.0f * FollowDuration * SendRate));
+
+		FFollowSplineState State;
+
+		int64 LegacyBits = 0;
+		int64 QuantizedBits = 0;
+		float MaxTimeError = 0.0f;
+		for (int32 Send = 0; Send < NumSends; ++Send)
+		{
+			const float Seconds = Send / SendRate;
+			State.CurrentDirectionMultiplier = (FMath::Fmod(Seconds, 2.0f * FollowDuration) < FollowDuration) ? 1 : -1;
+			State.CurrentSplineTime = (State.CurrentDirectionMultiplier > 0) ? FMath::Fmod(Seconds, FollowDuration) : (FollowDuration - FMath::Fmod(Seconds, FollowDuration));
+
+			FNetBitWriter LegacyWriter(nullptr, 256);
+			SerializeFollowSplineStateLegacy(LegacyWriter, State);
+			LegacyBits += LegacyWriter.GetNumBits();
+
+			FNetBitWriter Writer(nullptr, 256);
+			bool bSuccess = false;
+			State.NetSerialize(Writer, nullptr, bSuccess);
+			QuantizedBits += Writer.GetNumBits();
+
+			FNetBitReader Reader(nullptr, Writer.GetData(), Writer.GetNumBits());
+			FFollowSplineState Received;
+			Received.NetSerialize(Reader, nullptr, bSuccess);
+			MaxTimeError = FMath::Max(MaxTimeError, FMath::Abs(Received.CurrentSplineTime - State.CurrentSplineTime));
+		}
+
+		const double LegacyBytesPerSecond = (LegacyBits / 8.0) / NumSends * SendRate;
+		const double QuantizedBytesPerSecond = (QuantizedBits / 8.0) / NumSends * SendRate;
+		UE_LOG(LogMover, Display, TEXT("FollowSpline NetSerialize: %.1fs follow duration at %.0fHz | legacy %.1f bytes/s per mover | quantized %.1f bytes/s per mover (quantum %.4fs, max error %.4fs)"),
+			FollowDuration, SendRate, LegacyBytesPerSecond, QuantizedBytesPerSecond, FFollowSplineState::NetTimeQuantum, MaxTimeError);
+	}
+
+	static FAutoConsoleCommand BenchmarkNetSerializeCmd(
+		TEXT("MoverExamples.FollowSpline.BenchmarkNetSerialize"),
+		TEXT("Compares the bandwidth per mover of the original and quantized FollowSpline state serialization. Optional args: follow duration in seconds and send rate."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkNetSerialize));
 }
+#endif // !UE_BUILD_SHIPPING
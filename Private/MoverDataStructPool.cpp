@@ -0,0 +1,57 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "MoverDataStructPool.h"
+
+#include "HAL/IConsoleManager.h"
+#include "MoverLog.h"
+
+namespace MoverDataStructPool::Private
+{
+	static std::atomic<FMoverDataStructPoolCounters*> CountersListHead{ nullptr };
+}
+
+FMoverDataStructPoolCounters::FMoverDataStructPoolCounters(FString InName)
+	: Name(MoveTemp(InName))
+{
+	using namespace MoverDataStructPool::Private;
+
+	// Pools are only ever added, so pushing onto the front is all the locking needed
+	Next = CountersListHead.load(std::memory_order_relaxed);
+	while (!CountersListHead.compare_exchange_weak(Next, this, std::memory_order_release, std::memory_order_relaxed))
+	{
+	}
+}
+
+void FMoverDataStructPoolCounters::OnAllocated()
+{
+	const int32 NewNumLive = NumLive.fetch_add(1, std::memory_order_relaxed) + 1;
+
+	int32 OldPeak = PeakLive.load(std::memory_order_relaxed);
+	while (NewNumLive > OldPeak && !PeakLive.compare_exchange_weak(OldPeak, NewNumLive, std::memory_order_relaxed))
+	{
+	}
+}
+
+void FMoverDataStructPoolCounters::ForEach(TFunctionRef<void(const FMoverDataStructPoolCounters& Counters)> Visitor)
+{
+	for (const FMoverDataStructPoolCounters* Counters = MoverDataStructPool::Private::CountersListHead.load(std::memory_order_acquire); Counters; Counters = Counters->Next)
+	{
+		Visitor(*Counters);
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+namespace MoverDataStructPool::Private
+{
+	static FAutoConsoleCommand DumpPoolsCmd(
+		TEXT("MoverExamples.Pools.Dump"),
+		TEXT("Lists the live and peak number of pooled Mover data structs, per type."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			FMoverDataStructPoolCounters::ForEach([](const FMoverDataStructPoolCounters& Counters)
+			{
+				UE_LOG(LogMover, Display, TEXT("%s: %d live, %d peak"), *Counters.GetName(), Counters.GetNumLive(), Counters.GetPeakLive());
+			});
+		}));
+}
+#endif // !UE_BUILD_SHIPPING
@@ -16,6 +16,53 @@
 #include "EnhancedInputComponent.h"
 #include "InputAction.h"
 #include "DefaultMovementSet/NavMoverComponent.h"
+#include "MoverExamplesStats.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ability Inputs Sent"), STAT_MoverExamplesAbilityInputsSent, STATGROUP_MoverExamples);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ability Inputs Omitted"), STAT_MoverExamplesAbilityInputsOmitted, STATGROUP_MoverExamples);
+DECLARE_CYCLE_STAT(TEXT("Produce Input"), STAT_MoverExamplesProduceInput, STATGROUP_MoverExamples);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Produce Input Per Character (ms)"), STAT_MoverExamplesProduceInputPerCharacter, STATGROUP_MoverExamples);
+
+#if STATS
+namespace MoverExamplesCharacter::Utils::Private
+{
+	// ProduceInput time this frame, over every character that produced input. Game thread only, like ProduceInput.
+	struct FProduceInputTotals
+	{
+		uint64 Frame = 0;
+		uint64 Cycles = 0;
+		uint32 NumCalls = 0;
+	};
+	static FProduceInputTotals ProduceInputTotals;
+
+	// Times one ProduceInput call and publishes the average so far this frame, since the cycle stat only shows the sum
+	class FScopedProduceInputAverage
+	{
+	public:
+		FScopedProduceInputAverage()
+			: StartCycles(FPlatformTime::Cycles64())
+		{
+		}
+
+		~FScopedProduceInputAverage()
+		{
+			FProduceInputTotals& Totals = ProduceInputTotals;
+			if (Totals.Frame != GFrameCounter)
+			{
+				Totals = FProduceInputTotals();
+				Totals.Frame = GFrameCounter;
+			}
+
+			Totals.Cycles += FPlatformTime::Cycles64() - StartCycles;
+			++Totals.NumCalls;
+			SET_FLOAT_STAT(STAT_MoverExamplesProduceInputPerCharacter, FPlatformTime::ToMilliseconds64(Totals.Cycles) / Totals.NumCalls);
+		}
+
+	private:
+		uint64 StartCycles;
+	};
+}
+#endif // STATS
 
 AMoverExamplesCharacter::AMoverExamplesCharacter(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -51,7 +98,7 @@ void AMoverExamplesCharacter::PostInitializeComponents()
 	Super::PostInitializeComponents();
 
 	// 获取CharacterMoverComponent，这是Mover系统的核心
-	CharacterMotionComponent = FindComponentByClass<UCharacterMoverComponent>();
+	RefreshCachedComponents();
 
 	if (CharacterMotionComponent)
 	{
@@ -64,6 +111,25 @@ void AMoverExamplesCharacter::PostInitializeComponents()
 	}
 }
 
+void AMoverExamplesCharacter::RefreshCachedComponents()
+{
+	CharacterMotionComponent = FindComponentByClass<UCharacterMoverComponent>();
+	NavMoverComponent = FindComponentByClass<UNavMoverComponent>();
+
+	// The camera follows the control rotation, which only has to be set up once
+	if (USpringArmComponent* SpringComp = FindComponentByClass<USpringArmComponent>())
+	{
+		SpringComp->bUsePawnControlRotation = true;
+	}
+}
+
+void AMoverExamplesCharacter::NotifyControllerChanged()
+{
+	CachedPlayerController = Cast<APlayerController>(GetController());
+
+	Super::NotifyControllerChanged();
+}
+
 /**
  * 每帧调用（在Mover系统模拟之后）
  * 1. 处理视角旋转（将输入应用到控制器）
@@ -81,7 +147,7 @@ void AMoverExamplesCharacter::Tick(float DeltaTime)
 
 	// 根据输入旋转摄像机
 	// Spin camera based on input
-	if (APlayerController* PC = Cast<APlayerController>(GetController()))
+	if (APlayerController* PC = CachedPlayerController.Get())
 	{
 		// 简单的输入缩放，真实游戏通常会映射到加速度曲线
 		// Simple input scaling. A real game will probably map this to an acceleration curve
@@ -110,13 +176,11 @@ void AMoverExamplesCharacter::BeginPlay()
 	Super::BeginPlay();
 
 	// 限制摄像机旋转角度
-	if (APlayerController* PC = Cast<APlayerController>(GetController()))
+	if (APlayerController* PC = CachedPlayerController.Get())
 	{
 		PC->PlayerCameraManager->ViewPitchMax = 89.0f;
 		PC->PlayerCameraManager->ViewPitchMin = -89.0f;
 	}
-	
-	NavMoverComponent = FindComponentByClass<UNavMoverComponent>();
 }
 
 /**
@@ -194,12 +258,31 @@ void AMoverExamplesCharacter::UpdateNavigationRelevance()
  */
 void AMoverExamplesCharacter::ProduceInput_Implementation(int32 SimTimeMs, FMoverInputCmdContext& InputCmdResult)
 {
+	// Total for all characters. Produce Input Per Character is the average of each call.
+	SCOPE_CYCLE_COUNTER(STAT_MoverExamplesProduceInput);
+#if STATS
+	MoverExamplesCharacter::Utils::Private::FScopedProduceInputAverage ScopedProduceInputAverage;
+#endif
+
 	OnProduceInput((float)SimTimeMs, InputCmdResult);
 
 	if (bHasProduceInputinBpFunc)
 	{
 		InputCmdResult = OnProduceInputInBlueprint((float)SimTimeMs, InputCmdResult);
 	}
+
+	if (const FMoverExampleAbilityInputs* AbilityInputs = InputCmdResult.InputCollection.FindDataByType<FMoverExampleAbilityInputs>())
+	{
+		if (bOmitDefaultAbilityInputs && AbilityInputs->IsDefault())
+		{
+			InputCmdResult.InputCollection.RemoveDataByType(FMoverExampleAbilityInputs::StaticStruct());
+			INC_DWORD_STAT(STAT_MoverExamplesAbilityInputsOmitted);
+		}
+		else
+		{
+			INC_DWORD_STAT(STAT_MoverExamplesAbilityInputsSent);
+		}
+	}
 }
 
 
@@ -244,20 +327,13 @@ void AMoverExamplesCharacter::OnProduceInput(float DeltaMs, FMoverInputCmdContex
 	}
 
 
-	// 查找弹簧臂组件并启用Pawn控制旋转
-	// 注意：这里每帧查找组件不是最佳实践，实际项目应缓存引用
-	if (USpringArmComponent* SpringComp = FindComponentByClass<USpringArmComponent>())
-	{
-		// This is not best practice: do not search for component every frame
-		SpringComp->bUsePawnControlRotation = true;
-	}
+	// 弹簧臂的Pawn控制旋转已在RefreshCachedComponents中设置，不再每帧查找组件
 
 	// 初始化控制旋转为零
 	CharacterInputs.ControlRotation = FRotator::ZeroRotator;
 
-	// 获取玩家控制器旋转（摄像机方向）
-	APlayerController* PC = Cast<APlayerController>(GetController());
-	if (PC)
+	// 获取玩家控制器旋转（摄像机方向），控制器在NotifyControllerChanged中缓存
+	if (const APlayerController* PC = CachedPlayerController.Get())
 	{
 		CharacterInputs.ControlRotation = PC->GetControlRotation();
 	}
@@ -380,7 +456,7 @@ void AMoverExamplesCharacter::OnProduceInput(float DeltaMs, FMoverInputCmdContex
 
 	if (bUseBaseRelativeMovement)
 	{
-		if (const UCharacterMoverComponent* MoverComp = GetComponentByClass<UCharacterMoverComponent>())
+		if (const UCharacterMoverComponent* MoverComp = CharacterMotionComponent)
 		{
 			// 获取当前移动平台
 			if (UPrimitiveComponent* MovementBase = MoverComp->GetMovementBase())
@@ -3,29 +3,61 @@
 #pragma once
 
 #include "MoverTypes.h"
+#include "MoverDataStructPool.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "AbilityInputs.generated.h"
 
-// Data block containing extended ability inputs used by MoverExamples characters
+// Data block containing extended ability inputs used by MoverExamples characters. The buttons are reflected bitfields,
+// so they pack into a single byte while Blueprints keep their bool pins.
 USTRUCT(BlueprintType)
 struct MOVEREXAMPLES_API FMoverExampleAbilityInputs : public FMoverDataStructBase
 {
 	GENERATED_USTRUCT_BODY()
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = Mover)
-	bool bIsDashJustPressed = false;
+	uint8 bIsDashJustPressed : 1;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = Mover)
-    bool bIsAimPressed = false;
+	uint8 bIsAimPressed : 1;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = Mover)
-	bool bIsVaultJustPressed = false;
+	uint8 bIsVaultJustPressed : 1;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = Mover)
-	bool bWantsToStartZiplining = false;
+	uint8 bWantsToStartZiplining : 1;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = Mover)
-	bool bWantsToBeCrouched = false;
+	uint8 bWantsToBeCrouched : 1;
+
+	FMoverExampleAbilityInputs()
+		: bIsDashJustPressed(false)
+		, bIsAimPressed(false)
+		, bIsVaultJustPressed(false)
+		, bWantsToStartZiplining(false)
+		, bWantsToBeCrouched(false)
+	{
+	}
+
+	bool IsDashJustPressed() const { return bIsDashJustPressed; }
+	bool IsAimPressed() const { return bIsAimPressed; }
+	bool IsVaultJustPressed() const { return bIsVaultJustPressed; }
+	bool WantsToStartZiplining() const { return bWantsToStartZiplining; }
+	bool WantsToBeCrouched() const { return bWantsToBeCrouched; }
+
+	void SetDashJustPressed(bool bValue) { bIsDashJustPressed = bValue; }
+	void SetAimPressed(bool bValue) { bIsAimPressed = bValue; }
+	void SetVaultJustPressed(bool bValue) { bIsVaultJustPressed = bValue; }
+	void SetWantsToStartZiplining(bool bValue) { bWantsToStartZiplining = bValue; }
+	void SetWantsToBeCrouched(bool bValue) { bWantsToBeCrouched = bValue; }
+
+	// Whether no buttons are pressed. Producers may leave such inputs out of the input command entirely.
+	bool IsDefault() const
+	{
+		return !(bIsDashJustPressed | bIsAimPressed | bIsVaultJustPressed | bWantsToStartZiplining | bWantsToBeCrouched);
+	}
+
+	// Inputs found in Collection, or the default (no buttons pressed) when they were left out
+	static const FMoverExampleAbilityInputs& FindOrDefault(const FMoverDataCollection& Collection);
 
 	// Implementation of FMoverDataStructBase
 	virtual bool ShouldReconcile(const FMoverDataStructBase& AuthorityState) const override
@@ -64,20 +96,24 @@ struct MOVEREXAMPLES_API FMoverExampleAbilityInputs : public FMoverDataStructBas
 	// @return newly allocated copy of this FMoverExampleAbilityInputs. Must be overridden by child classes
 	virtual FMoverDataStructBase* Clone() const override
 	{
-		// TODO: ensure that this memory allocation jives with deletion method
-		FMoverExampleAbilityInputs* CopyPtr = new FMoverExampleAbilityInputs(*this);
-		return CopyPtr;
+		return TMoverDataStructPool<FMoverExampleAbilityInputs>::Create(*this);
 	}
 
 	virtual bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess) override
 	{
 		Super::NetSerialize(Ar, Map, bOutSuccess);
 
-		Ar.SerializeBits(&bIsDashJustPressed, 1);
-		Ar.SerializeBits(&bIsAimPressed, 1);
-		Ar.SerializeBits(&bIsVaultJustPressed, 1);
-		Ar.SerializeBits(&bWantsToStartZiplining, 1);
-		Ar.SerializeBits(&bWantsToBeCrouched, 1);
+		// One bit per button
+		uint8 Buttons = (bIsDashJustPressed << 0) | (bIsAimPressed << 1) | (bIsVaultJustPressed << 2) | (bWantsToStartZiplining << 3) | (bWantsToBeCrouched << 4);
+		Ar.SerializeBits(&Buttons, 5);
+		if (Ar.IsLoading())
+		{
+			bIsDashJustPressed = (Buttons >> 0) & 1;
+			bIsAimPressed = (Buttons >> 1) & 1;
+			bIsVaultJustPressed = (Buttons >> 2) & 1;
+			bWantsToStartZiplining = (Buttons >> 3) & 1;
+			bWantsToBeCrouched = (Buttons >> 4) & 1;
+		}
 
 		bOutSuccess = true;
 		return true;
@@ -88,16 +124,19 @@ struct MOVEREXAMPLES_API FMoverExampleAbilityInputs : public FMoverDataStructBas
 	virtual void ToString(FAnsiStringBuilderBase& Out) const override
 	{
 		Super::ToString(Out);
-		Out.Appendf("bIsDashJustPressed: %i\n", bIsDashJustPressed);
-		Out.Appendf("bIsAimPressed: %i\n", bIsAimPressed);
-		Out.Appendf("bIsVaultJustPressed: %i\n", bIsVaultJustPressed);
-		Out.Appendf("bWantsToStartZiplining: %i\n", bWantsToStartZiplining);
-		Out.Appendf("bWantsToBeCrouched: %i\n", bWantsToBeCrouched);
+		Out.Appendf("bIsDashJustPressed: %i\n", IsDashJustPressed());
+		Out.Appendf("bIsAimPressed: %i\n", IsAimPressed());
+		Out.Appendf("bIsVaultJustPressed: %i\n", IsVaultJustPressed());
+		Out.Appendf("bWantsToStartZiplining: %i\n", WantsToStartZiplining());
+		Out.Appendf("bWantsToBeCrouched: %i\n", WantsToBeCrouched());
 	}
 
 	virtual void AddReferencedObjects(FReferenceCollector& Collector) override { Super::AddReferencedObjects(Collector); }
 };
 
+// Five one-bit fields share a byte, so the buttons add at most one aligned word to the base struct
+static_assert(sizeof(FMoverExampleAbilityInputs) <= sizeof(FMoverDataStructBase) + alignof(FMoverDataStructBase), "Ability buttons should pack into a single byte");
+
 UCLASS()
 class MOVEREXAMPLES_API UMoverExampleAbilityInputsLibrary : public UBlueprintFunctionLibrary
 {
@@ -107,11 +146,6 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Mover|Input")
 	static FMoverExampleAbilityInputs GetMoverExampleAbilityInputs(const FMoverDataCollection& FromCollection)
 	{
-		if (const FMoverExampleAbilityInputs* FoundInputs = FromCollection.FindDataByType<FMoverExampleAbilityInputs>())
-		{
-			return *FoundInputs;
-		}
-
-		return FMoverExampleAbilityInputs();
+		return FMoverExampleAbilityInputs::FindOrDefault(FromCollection);
 	}
-};
\ No newline at end of file
+};
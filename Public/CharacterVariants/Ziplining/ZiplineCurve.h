@@ -0,0 +1,48 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+/**
+ * Shape of a zipline's cable, from its A endpoint to its B endpoint, sagging under its own weight. Stored as world space
+ * points spaced evenly along the arc length, so a rider's progress maps to a location with one lerp and moving at a
+ * constant speed is a constant change in progress. Immutable once built, and shared by everyone riding the zipline.
+ */
+struct MOVEREXAMPLES_API FZiplineCurve
+{
+	TArray<FVector> Points;
+	float Length = 0.0f;
+
+	// What the curve was built from, to detect when it needs rebuilding
+	FVector EndpointA = FVector::ZeroVector;
+	FVector EndpointB = FVector::ZeroVector;
+	float SagDepth = 0.0f;
+
+	/**
+	 * Builds the curve hanging SagDepth below the midpoint of A and B (a parabola, close enough to a catenary for cables
+	 * this taut). Uses as few points as keep the polyline within Tolerance of the curve; a straight zipline needs two.
+	 */
+	void Build(const FVector& A, const FVector& B, float InSagDepth, float Tolerance = 1.0f);
+
+	bool IsBuiltFrom(const FVector& A, const FVector& B, float InSagDepth) const;
+
+	int32 NumSpans() const { return Points.Num() - 1; }
+
+	// Progress is the fraction of the arc length from A (0) to B (1)
+	FVector GetLocationAtProgress(float Progress) const;
+
+	// Unit direction of travel from A to B at Progress
+	FVector GetDirectionAtProgress(float Progress) const;
+
+	// Progress of a Point lying on span SpanIndex
+	float GetProgressOnSpan(int32 SpanIndex, const FVector& Point) const;
+
+	// Sag of a cable of CableLength hanging between A and B, for a parabola of the same arc length
+	static float ComputeSagDepthForCableLength(const FVector& A, const FVector& B, float CableLength);
+
+private:
+	// Converts progress to a span index and the alpha within it
+	int32 GetSpan(float Progress, float& OutAlpha) const;
+};
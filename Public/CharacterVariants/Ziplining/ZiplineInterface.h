@@ -27,4 +27,22 @@ public:
 
 	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "Zipline")
 	USceneComponent* GetEndComponent();
+
+	// Whether the endpoints can move while ridden. Riders cache the endpoints of static ziplines when grabbing them,
+	// and only read them again every tick for dynamic ones. The zipline registry must be told when a zipline moves.
+	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "Zipline")
+	bool IsDynamic();
+	virtual bool IsDynamic_Implementation() { return false; }
+
+	// How far the cable sags below the midpoint of its endpoints. Negative derives it from the length of the zipline's
+	// cable component if it has one, and otherwise makes the zipline straight.
+	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "Zipline")
+	float GetSagDepth();
+	virtual float GetSagDepth_Implementation() { return -1.0f; }
+
+	// Ziplines this one is chained to. Riders reaching an end of this zipline next to an end of a connected one carry
+	// on along it without letting go. Connections only need listing on one of the two ziplines.
+	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "Zipline")
+	TArray<AActor*> GetConnectedZiplines();
+	virtual TArray<AActor*> GetConnectedZiplines_Implementation() { return TArray<AActor*>(); }
 };
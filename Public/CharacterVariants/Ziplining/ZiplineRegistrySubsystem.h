@@ -0,0 +1,175 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "CharacterVariants/Ziplining/ZiplineCurve.h"
+#include "ZiplineRegistrySubsystem.generated.h"
+
+
+/**
+ * Uniform grid of line segments, answering "closest segment within radius" by only visiting the cells around the query.
+ * Each segment is added to every cell it passes through.
+ */
+struct MOVEREXAMPLES_API FZiplineSpatialGrid
+{
+	struct FSegment
+	{
+		FVector Start = FVector::ZeroVector;
+		FVector End = FVector::ZeroVector;
+		bool bIsValid = false;
+	};
+
+	explicit FZiplineSpatialGrid(float InCellSize = 1000.0f);
+
+	void Reset();
+
+	// Returns the index of the new segment. Indices of removed segments are reused.
+	int32 AddSegment(const FVector& Start, const FVector& End);
+	void RemoveSegment(int32 SegmentIndex);
+
+	// Finds the segment closest to Point, if any is within Radius
+	bool FindNearestSegment(const FVector& Point, float Radius, int32& OutSegmentIndex, FVector& OutClosestPoint) const;
+
+	const FSegment& GetSegment(int32 SegmentIndex) const { return Segments[SegmentIndex]; }
+	int32 NumSegments() const { return Segments.Num() - FreeSegments.Num(); }
+
+private:
+	FIntVector GetCell(const FVector& Location) const;
+
+	// Calls Func once per cell the segment passes through
+	template<typename FuncType>
+	void ForEachCellOnSegment(const FVector& Start, const FVector& End, FuncType&& Func) const;
+
+	float CellSize;
+	float InvCellSize;
+
+	TArray<FSegment> Segments;
+	TArray<int32> FreeSegments;
+	TMap<FIntVector, TArray<int32, TInlineAllocator<4>>> Cells;
+};
+
+
+/**
+ * Where a rider reaching one end of a zipline carries on
+ */
+struct FZiplineJunction
+{
+	TWeakObjectPtr<AActor> NextZipline;
+	bool bNextMovingAtoB = true;
+	float Alignment = -1.0f;	// Cosine of the turn taken at the junction, to pick the straightest of several
+};
+
+/**
+ * ZiplineRegistrySubsystem: keeps every IZipline actor in the world in a spatial grid, so movers can find a grabbable
+ * zipline without overlap queries, and owns each zipline's cable curve, shared by all its riders. Ziplines are
+ * registered when play begins and when spawned, and unregistered when destroyed. The curve is built at registration;
+ * call RegisterZipline again after moving a zipline. Dynamic ziplines are checked for that once per frame by the
+ * registry itself, so riders never rebuild a curve other riders share. Junctions between connected ziplines are worked
+ * out whenever the set of ziplines changes, so riders only look them up. Game thread only.
+ */
+UCLASS()
+class MOVEREXAMPLES_API UZiplineRegistrySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin USubsystem Interface.
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface.
+
+	//~ Begin UWorldSubsystem Interface.
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	//~ End UWorldSubsystem Interface.
+
+	//~ Begin FTickableGameObject Interface.
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject Interface.
+
+	// Adds ZiplineActor, or rebuilds its curve if its endpoints or sag changed since it was registered. Ignores actors
+	// not implementing IZipline.
+	UFUNCTION(BlueprintCallable, Category = "Zipline")
+	void RegisterZipline(AActor* ZiplineActor);
+
+	UFUNCTION(BlueprintCallable, Category = "Zipline")
+	void UnregisterZipline(AActor* ZiplineActor);
+
+	// Returns the zipline whose cable is closest to Location, if any is within Radius. OutProgress is the closest point's
+	// progress along the zipline's curve.
+	AActor* FindNearestZipline(const FVector& Location, float Radius, FVector* OutClosestPoint = nullptr, float* OutProgress = nullptr) const;
+
+	// Returns the curve of a registered zipline
+	TSharedPtr<const FZiplineCurve, ESPMode::ThreadSafe> FindZiplineCurve(const AActor* ZiplineActor) const;
+
+	// Whether a registered zipline said it moves (IZipline::IsDynamic) when it was registered
+	bool IsDynamicZipline(const AActor* ZiplineActor) const;
+
+	static constexpr uint32 InvalidNetId = 0;
+
+	/**
+	 * Compact id to send instead of an object reference. The CRC of the zipline's path and nothing else, so every machine
+	 * agrees on it without replicating anything, whatever order ziplines were registered in. Ziplines whose names aren't
+	 * stable for networking (e.g. spawned at runtime) get InvalidNetId and have to be sent as a reference. Two paths with
+	 * the same CRC are a content error, reported when the second registers.
+	 */
+	uint32 GetZiplineNetId(const AActor* ZiplineActor) const;
+	AActor* FindZiplineByNetId(uint32 NetId) const;
+
+	// Returns where a rider of ZiplineActor reaching its B end (or A end) carries on, if it's connected there
+	const FZiplineJunction* FindJunction(const AActor* ZiplineActor, bool bAtEndB) const;
+
+	int32 NumZiplines() const { return Ziplines.Num(); }
+
+	// How close the ends of connected ziplines have to be to form a junction
+	static constexpr float JunctionTolerance = 100.0f;
+
+private:
+	void OnActorSpawned(AActor* SpawnedActor);
+	void OnActorDestroyed(AActor* DestroyedActor);
+
+	// Sag of a zipline's cable, from the interface or else its cable component
+	static float GetZiplineSagDepth(AActor* ZiplineActor, const FVector& ZipLocA, const FVector& ZipLocB);
+
+	static uint32 ComputeZiplineNetId(const AActor* ZiplineActor);
+
+	// Forgets ZiplineActor without rebuilding junctions. Returns whether it was registered with connections to rebuild.
+	bool RemoveZipline(AActor* ZiplineActor);
+
+	void RebuildJunctions();
+	void ConnectZiplines(AActor* ZiplineActor, AActor* OtherZipline);
+
+	struct FRegisteredZipline
+	{
+		TSharedPtr<const FZiplineCurve, ESPMode::ThreadSafe> Curve;
+		TArray<int32> GridSegments;		// One per curve span
+		uint32 NetId = InvalidNetId;
+		TArray<TWeakObjectPtr<AActor>> ConnectedZiplines;
+		FZiplineJunction Junctions[2];		// At the A end, then the B end
+		bool bIsDynamic = false;
+	};
+
+	struct FGridSegmentOwner
+	{
+		TWeakObjectPtr<AActor> ZiplineActor;
+		int32 SpanIndex = INDEX_NONE;
+	};
+
+	FZiplineSpatialGrid Grid;
+
+	// Zipline and curve span of each grid segment, indexed like the grid's segments
+	TArray<FGridSegmentOwner> SegmentOwners;
+	TMap<TObjectKey<AActor>, FRegisteredZipline> Ziplines;
+
+	TMap<uint32, TWeakObjectPtr<AActor>> NetIdZiplines;
+
+	TArray<TWeakObjectPtr<AActor>> DynamicZiplines;		// Registered ziplines that can move, refreshed every tick
+
+	bool bIsRegisteringLevelZiplines = false;	// Junctions are built once everything is registered
+
+	FDelegateHandle ActorSpawnedHandle;
+	FDelegateHandle ActorDestroyedHandle;
+};
@@ -4,8 +4,13 @@
 
 #include "CoreMinimal.h"
 #include "MovementMode.h"
+#include "CharacterVariants/Ziplining/ZiplineCurve.h"
+#include "MoverDataStructPool.h"
 #include "ZipliningMode.generated.h"
 
+struct FZipliningState;
+class UZiplineRegistrySubsystem;
+
 /**
  *
 Frame Start
@@ -41,9 +46,55 @@ public:
 	virtual void GenerateMove_Implementation(const FMoverTickStartData& StartState, const FMoverTimeStep& TimeStep, FProposedMove& OutProposedMove) const override;
 	virtual void SimulationTick_Implementation(const FSimulationTickParams& Params, FMoverTickEndData& OutputState) override;
 
+	/**
+	 * Where a ziplining mover in SyncState will be Seconds from now (or ago, if negative), without simulating.
+	 * Const, but game thread only: a state that hasn't measured its hang offset yet measures the actor's bounds. Uses the
+	 * zipline curve cached in SyncState, as of its last simulation tick.
+	 */
+	FTransform EvaluateAtTime(const FMoverSyncState& SyncState, float Seconds) const;
+
 	// Maximum speed 
 	UPROPERTY(EditAnywhere, Category = "Ziplining", meta = (ClampMin = "1", UIMin = "1", ForceUnits = "cm/s"))
 	float MaxSpeed = 1000.0f;
+
+	// Riders never slow below this, even going uphill, so they always reach the end
+	UPROPERTY(EditAnywhere, Category = "Ziplining", meta = (ClampMin = "1", UIMin = "1", ForceUnits = "cm/s"))
+	float MinSpeed = 100.0f;
+
+	// Speed when grabbing the zipline
+	UPROPERTY(EditAnywhere, Category = "Ziplining", meta = (ClampMin = "0", UIMin = "0", ForceUnits = "cm/s"))
+	float InitialSpeed = 300.0f;
+
+	// Acceleration pulling riders down the slope of the cable. Zero gives the old constant speed ride at InitialSpeed.
+	UPROPERTY(EditAnywhere, Category = "Ziplining", meta = (ClampMin = "0", UIMin = "0", ForceUnits = "cm/s^2"))
+	float Gravity = 980.0f;
+
+	// Deceleration per unit of speed, from air and pulley friction. Terminal speed on a slope is its acceleration divided by this.
+	UPROPERTY(EditAnywhere, Category = "Ziplining", meta = (ClampMin = "0", UIMin = "0"))
+	float Drag = 0.5f;
+
+	// How close the mover's location must be to a zipline for it to be grabbed
+	UPROPERTY(EditAnywhere, Category = "Ziplining", meta = (ClampMin = "0", UIMin = "0", ForceUnits = "cm"))
+	float GrabRadius = 100.0f;
+
+protected:
+	/**
+	 * Advances InOutSpeed by DeltaSeconds under a constant slope acceleration and drag, in closed form so the result
+	 * doesn't depend on how the time is split into steps. Returns the distance travelled.
+	 */
+	float AdvanceSpeed(float& InOutSpeed, float SlopeAcceleration, float DeltaSeconds) const;
+
+	// Acceleration along the direction of travel at Progress on Curve
+	float ComputeSlopeAcceleration(const FZiplineCurve& Curve, float Progress, float DirectionSign, const FVector& UpDirection) const;
+
+	/**
+	 * Moves ZipState onto the zipline joined to the end it's heading for, keeping its speed. Returns false at a dead end,
+	 * leaving ZipState untouched.
+	 */
+	bool TransferToNextZipline(FZipliningState& ZipState, const UZiplineRegistrySubsystem& ZiplineRegistry) const;
+
+	// Most junctions a single step can pass through, in case of very short ziplines
+	static constexpr int32 MaxTransfersPerStep = 4;
 };
 
 
@@ -62,11 +113,48 @@ struct FZipliningState : public FMoverDataStructBase
 	TObjectPtr<AActor> ZiplineActor;
 	bool bIsMovingAtoB;
 
+	// Registry id of ZiplineActor, sent instead of the reference when valid. The actor is looked up from it on receipt.
+	uint32 ZiplineNetId;
+
+	// Fraction of the zipline's arc length from its A endpoint (0) to its B endpoint (1). Sent quantized to ProgressQuantum.
+	float Progress;
+
+	static constexpr float ProgressQuantum = 1.0f / 65535.0f;
+
+	// Speed along the cable. Sent quantized to SpeedQuantum.
+	float Speed;
+
+	static constexpr float SpeedQuantum = 0.1f;
+
+	// Cable curve being traversed, shared with the zipline registry and every other rider. Looked up when grabbed (or on
+	// the first tick after being received) rather than read through the IZipline interface every tick, and only looked
+	// up again each tick for dynamic ziplines. Not replicated.
+	bool bIsDynamicZipline;
+	TSharedPtr<const FZiplineCurve, ESPMode::ThreadSafe> Curve;
+
+	// Distance between the mover's origin and the zipline, cached with the capsule half height (or scale) it was measured
+	// at so it's only measured again when that changes. Negative until measured. Not replicated.
+	float HangOffset;
+	float HangOffsetKey;
+
 	FZipliningState()
 		: bIsMovingAtoB(true)
+		, ZiplineNetId(0)
+		, Progress(0.0f)
+		, Speed(0.0f)
+		, bIsDynamicZipline(false)
+		, HangOffset(-1.0f)
+		, HangOffsetKey(0.0f)
 	{
 	}
 
+	// Whether Other is riding the same zipline, by net id when there is one
+	bool IsSameZipline(const FZipliningState& Other) const;
+
+	// Looks up ZiplineActor from its net id if needed, then its current curve from the registry. Returns false if the
+	// zipline isn't registered in World.
+	bool ResolveZipline(const UWorld* World);
+
 	virtual FMoverDataStructBase* Clone() const override;
 	virtual bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess) override;
 	virtual UScriptStruct* GetScriptStruct() const override { return StaticStruct(); }
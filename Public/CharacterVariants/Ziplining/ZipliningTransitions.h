@@ -26,10 +26,31 @@ class UZiplineStartTransition : public UBaseMovementModeTransition
 	GENERATED_UCLASS_BODY()
 
 public:
+	virtual void OnRegistered() override;
+	virtual void OnUnregistered() override;
 	virtual FTransitionEvalResult Evaluate_Implementation(const FSimulationTickParams& Params) const override;
 
 	UPROPERTY(EditAnywhere, Category = "Ziplining")
 	FName ZipliningModeName = ExtendedModeNames::Ziplining;
+
+	// Keep track of ziplines touching the mover through its overlap events, so evaluating with nothing touching is just a
+	// check of that list. While one is touching and the grab input is held, each evaluation still makes one registry
+	// query, since being inside a zipline's volume doesn't mean its cable is in reach. Otherwise the registry is queried
+	// on every evaluation while the grab input is held.
+	UPROPERTY(EditAnywhere, Category = "Ziplining")
+	bool bTrackOverlappingZiplines = true;
+
+protected:
+	UFUNCTION()
+	void OnOwnerBeginOverlap(AActor* OverlappedActor, AActor* OtherActor);
+
+	UFUNCTION()
+	void OnOwnerEndOverlap(AActor* OverlappedActor, AActor* OtherActor);
+
+private:
+	// Ziplines currently overlapping the mover. Rarely more than one.
+	TArray<TWeakObjectPtr<AActor>, TInlineAllocator<2>> OverlappingZiplines;
+	TWeakObjectPtr<AActor> TrackedActor;
 };
 
 /**
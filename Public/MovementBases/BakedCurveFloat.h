@@ -0,0 +1,48 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UCurveFloat;
+
+/**
+ * A UCurveFloat sampled at evenly spaced times over [0, 1], evaluated with a linear lookup instead of a key search and
+ * rich curve evaluation. Tables are immutable once built and shared by everything that references the same curve asset.
+ */
+struct MOVEREXAMPLES_API FBakedCurveFloat
+{
+	static constexpr int32 NumSamples = 257;
+
+	TArray<float> Values;
+	float MaxError = 0.0f;		// Largest difference measured against the source curve between samples while baking
+
+	TWeakObjectPtr<const UCurveFloat> SourceCurve;
+
+	// Returns the shared table for Curve, baking it on first use. Game thread only, since baking samples the curve asset.
+	// The returned table can be evaluated from any thread.
+	static TSharedPtr<const FBakedCurveFloat, ESPMode::ThreadSafe> FindOrBake(const UCurveFloat* Curve);
+
+	// Editor only: drops a curve's table whenever the curve is edited. Called by the module on startup and shutdown, so
+	// nothing is left bound to unloaded code.
+	static void StartWatchingCurveEdits();
+	static void StopWatchingCurveEdits();
+
+	// Bumped whenever a shared table is invalidated (e.g. its curve was edited). Holders of a table should remember the
+	// generation they found it in and find it again once this changes.
+	static uint32 GetCurrentGeneration();
+
+	// Drops the shared table for Curve. Existing holders keep their copy until they see the generation change.
+	static void Invalidate(const UCurveFloat* Curve);
+
+	float Evaluate(float Time) const
+	{
+		const float SamplePos = FMath::Clamp(Time, 0.0f, 1.0f) * (NumSamples - 1);
+		const int32 Index = FMath::Min(static_cast<int32>(SamplePos), NumSamples - 2);
+		return FMath::Lerp(Values[Index], Values[Index + 1], SamplePos - Index);
+	}
+
+private:
+	void Bake(const UCurveFloat& Curve);
+};
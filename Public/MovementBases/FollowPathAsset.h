@@ -0,0 +1,44 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "MovementBases/FollowPathMode.h"
+#include "FollowPathAsset.generated.h"
+
+
+/**
+ * FollowPathAsset: an immutable path that any number of FollowPathModes can reference. The path is baked once on
+ * creation or load, so movers sharing a route only pay for their own FFollowPathState.
+ */
+UCLASS(BlueprintType)
+class MOVEREXAMPLES_API UFollowPathAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	// Ordered path locations to visit, as offsets from wherever the mover starts following the path
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Pathing)
+	TArray<FVector> PathPoints;
+
+	// Baked PathPoints. Only a read: change the points through SetPathPoints, which rebakes them.
+	const FFollowPathBakedTable& GetBakedPath() const;
+
+	// Replaces the path points and rebakes. Not safe to call while movers referencing this asset are simulating.
+	UFUNCTION(BlueprintCallable, Category = Pathing)
+	void SetPathPoints(const TArray<FVector>& NewPathPoints);
+
+	//~ Begin UObject Interface.
+	virtual void PostInitProperties() override;
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif // WITH_EDITOR
+	//~ End UObject Interface.
+
+private:
+	void BakePath();
+
+	FFollowPathBakedTable BakedPath;
+};
@@ -6,8 +6,11 @@
 #include "MovementMode.h"
 #include "Components/InterpToMovementComponent.h"
 #include "MoverTypes.h"
+#include "MoverDataStructPool.h"
 #include "FollowPathMode.generated.h"
 
+class UFollowPathAsset;
+
 
 /**
  * Controls how rotation is handled during pathing
@@ -25,9 +28,59 @@ enum class EFollowPathRotationType : uint8
 };
 
 
+/**
+ * Baked, read-only representation of a follow path, laid out as parallel arrays so that evaluation only touches
+ * the data it needs. Built once per path from its control points; simulation never writes to it.
+ * Positions are resolved relative to the path's base location, so evaluating a world position is a single add.
+ */
+struct MOVEREXAMPLES_API FFollowPathBakedTable
+{
+	TArray<FVector> Positions;			// Control point positions, relative to the base location the path was baked against
+	TArray<FVector> PointTangents;		// Smoothed path tangent at each control point
+	TArray<float> StartPcts;			// Cumulative path pct at each control point. The last entry is always exactly 1
+	TArray<float> SegmentInvPcts;		// 1 / pct span of each segment (NumPoints - 1 entries), 0 for zero-length segments
+	TArray<FVector> SegmentDirections;	// Normalized direction of each segment
+	float TotalDistance = 0.f;			// Summed distance between all control points
+
+	void Reset();
+
+	// Resolves and bakes ControlPoints. Relative points are kept as-is, absolute points are made relative to BaseLocation.
+	void Build(const TArray<FInterpControlPoint>& ControlPoints, const FVector& BaseLocation);
+
+	// Bakes a path whose points are all offsets from the base location
+	void Build(TConstArrayView<FVector> RelativePoints);
+
+	int32 NumPoints() const { return Positions.Num(); }
+	int32 NumSegments() const { return FMath::Max(0, Positions.Num() - 1); }
+	bool IsEmpty() const { return Positions.IsEmpty(); }
+
+	/**
+	 * Returns the segment containing PathPct, or INDEX_NONE if the path has fewer than 2 points. Lookups first check the
+	 * caller's last known segment and its neighbors so steady-state pathing is O(1), falling back to a binary search
+	 * when the hint is stale (teleports, resimulation, looping).
+	 */
+	int32 FindSegment(float PathPct, int32 HintSegment = INDEX_NONE) const;
+
+	// Position at PathPct relative to the base location
+	FVector EvaluatePosition(float PathPct, int32 Segment) const;
+
+	// Tangent at PathPct, blended between the tangents of the segment's control points
+	FVector EvaluateInterpolatedTangent(float PathPct, int32 Segment) const;
+
+	// Direction of the segment we're on, or forward if there is none
+	FVector EvaluateSegmentDirection(float PathPct, int32 Segment) const;
+
+private:
+	// Derives distances, pcts and tangents once Positions are filled in
+	void BuildFromPositions();
+};
+
+
 /**
  * FollowPathMode: This mode performs simple movement of the associated actor, attempting to interpolate
  * through a series of locations. There are variety of settings that affect behavior, such as speed and looping.
+ * The path either comes from a shared UFollowPathAsset or from the inline ControlPoints, which are baked when the
+ * mode is registered. Simulation never modifies the mode, so all per-mover pathing state lives in FFollowPathState.
  */
 UCLASS(Blueprintable, BlueprintType)
 class MOVEREXAMPLES_API UFollowPathMode : public UBaseMovementMode
@@ -39,7 +92,11 @@ public:
 	virtual void GenerateMove_Implementation(const FMoverTickStartData& StartState, const FMoverTimeStep& TimeStep, FProposedMove& OutProposedMove) const override;
 	virtual void SimulationTick_Implementation(const FSimulationTickParams& Params, FMoverTickEndData& OutputState) override;
 
-	// List of ordered path locations to visit
+	// Shared path to follow. Takes precedence over ControlPoints, and lets any number of movers reference one baked path
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Pathing)
+	TObjectPtr<UFollowPathAsset> PathAsset;
+
+	// List of ordered path locations to visit, used when there is no PathAsset. Absolute points are resolved against the owner's location at registration.
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Pathing)
 	TArray<FInterpControlPoint> ControlPoints;
 
@@ -55,23 +112,40 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Pathing, meta = (UIMin = 0.1f, ClampMin = 0.1f, ForceUnits=s))
 	float Duration = 5.0f;
 
-protected:
+	/**
+	 * Where a mover in SyncState will be Seconds from now (or ago, if negative), without simulating.
+	 * Const and allocation-free. Stops are not reversible: querying into the past of a mover that has finished a one-shot
+	 * path assumes it had only just arrived.
+	 */
+	FTransform EvaluateAtTime(const FMoverSyncState& SyncState, float Seconds) const;
 
+	// The baked path this mode follows, from either the PathAsset or the inline ControlPoints
+	const FFollowPathBakedTable& GetBakedPath() const;
+
+	/**
+	 * Advances a path pct by DeltaPct worth of travel (>= 0) in closed form, applying any number of loops, bounces or stops
+	 * that happen along the way. Cost is independent of DeltaPct, so large or uneven time steps land in the same place as many small ones.
+	 */
+	static float AdvancePathPct(EInterpToBehaviourType Behaviour, float InPathPct, float InDirectionMod, float DeltaPct, bool& OutStopped, float& OutNewDirectionMod);
+
+protected:
+	virtual void OnRegistered(const FName ModeName) override;
 
-	// Update the control points. Adjusts the positions of there are any actor control points as well as updating the spline type
+	// Update the control points. Rebakes the inline path table, resolving any absolute control points against the owning actor's location.
+	// Not called during simulation: call this after changing ControlPoints at runtime.
 	virtual void UpdateControlPoints(bool InForceUpdate);
 
 	// Based on current path pct + direction + time step, find the next path pct, possibly stopping or changing direction mid-step
-	float CalculateNewPathPct(float InPathPct, float InDirectionMod, float InDeltaSecs, bool& OutStopped, float& OutTimeRemainder, float& OutNewDirectionMod) const;
+	float CalculateNewPathPct(float InPathPct, float InDirectionMod, float InDeltaSecs, bool& OutStopped, float& OutNewDirectionMod) const;
 
-	// Find the necessary move delta to get onto path at a certain pct, based on current location
-	FVector ComputeMoveDelta(const FVector CurrentPos, const FVector BaseLocation, const float TargetPathPos) const;
+	// Find the necessary move delta to get onto path at a certain pct, based on current location. Segment comes from BakedPath.FindSegment.
+	FVector ComputeMoveDelta(const FVector CurrentPos, const FVector BaseLocation, const float TargetPathPos, const int32 Segment) const;
 
-	FRotator ComputeMoveOrientation(const float TargetPathPos, const FVector& BaseLocation, FRotator DefaultOrientation) const;
+	FRotator ComputeMoveOrientation(const float TargetPathPos, const int32 Segment, FRotator DefaultOrientation) const;
 
-	FVector ComputeInterpolatedTangentFromPathPct(const float PathPct) const;
+	FVector ComputeInterpolatedTangentFromPathPct(const float PathPct, const int32 Segment) const;
 	
-	FVector ComputeTangentFromPathPct(const float PathPct, const FVector& BaseLocation) const;
+	FVector ComputeTangentFromPathPct(const float PathPct, const int32 Segment) const;
 
 #if WITH_EDITOR
 	//~ Begin UObject Interface.
@@ -82,10 +156,7 @@ protected:
 
 private:
 
-	float TotalDistance;	// Cached distance summed between all control points
-	float TimeMultiplier;	// Converts seconds to path position percent
-
-	TArray<FVector> ControlPointPathTangents;
+	FFollowPathBakedTable InlineBakedPath;	// Baked from ControlPoints at registration. Unused when a PathAsset is set
 
 };
 
@@ -99,13 +170,24 @@ struct FFollowPathState : public FMoverDataStructBase
 	FVector BaseLocation;			// Starting point of this pathing, used for relative pathing
 	float CurrentPathPos;			// [0.0, 1.0] to indicate a position on the path, as a percent from start to finish. 
 	float CurrentDirectionMod;		// typically 1 or -1 to indicate direction we're traveling on the path
+	int32 CurrentSegment;			// Lookup hint: path segment we were on last step. Not replicated, only used to speed up segment searches
+	uint8 BaseLocationAge;			// Steps since BaseLocation was captured, wrapping. Not replicated, picks the steps BaseLocation is sent in
+	bool bHasBaseLocation;			// False when received without a BaseLocation, and in states simulated on from one, whose BaseLocation is only recovered. Not replicated
 
+	// Replicated path position resolution
+	static constexpr float PathPosQuantum = 1.0f / 65535.0f;
 
+	// BaseLocation is sent for the first few steps after it's captured, then once every period in case those were lost
+	static constexpr uint8 BaseLocationResendPeriod = 64;
+	static constexpr uint8 BaseLocationSendSteps = 4;
 
 	FFollowPathState()
 		: BaseLocation(FVector::ZeroVector)
 		, CurrentPathPos(-1.0f)
 		, CurrentDirectionMod(1.0f)
+		, CurrentSegment(INDEX_NONE)
+		, BaseLocationAge(0)
+		, bHasBaseLocation(true)
 	{
 	}
 
@@ -113,18 +195,7 @@ struct FFollowPathState : public FMoverDataStructBase
 
 	virtual FMoverDataStructBase* Clone() const override;
 
-
-	virtual bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess) override
-	{
-		Super::NetSerialize(Ar, Map, bOutSuccess);
-
-		Ar << BaseLocation;
-		Ar << CurrentPathPos;
-		Ar << CurrentDirectionMod;
-
-		bOutSuccess = true;
-		return true;
-	}
+	virtual bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess) override;
 
 	virtual UScriptStruct* GetScriptStruct() const override { return StaticStruct(); }
 
@@ -141,8 +212,11 @@ struct FFollowPathState : public FMoverDataStructBase
 	{
 		const FFollowPathState* AuthoritySyncState = static_cast<const FFollowPathState*>(&AuthorityState);
 
-		return !FVector::PointsAreSame(BaseLocation, AuthoritySyncState->BaseLocation) || 
-			   !FMath::IsNearlyEqual(CurrentPathPos, AuthoritySyncState->CurrentPathPos) ||
+		// A BaseLocation that wasn't sent can't disagree
+		const bool bCompareBaseLocation = bHasBaseLocation && AuthoritySyncState->bHasBaseLocation;
+
+		return (bCompareBaseLocation && !FVector::PointsAreSame(BaseLocation, AuthoritySyncState->BaseLocation)) ||
+			   !FMath::IsNearlyEqual(CurrentPathPos, AuthoritySyncState->CurrentPathPos, PathPosQuantum) ||
 			   !FMath::IsNearlyEqual(CurrentDirectionMod, AuthoritySyncState->CurrentDirectionMod);
 	}
 
@@ -151,7 +225,10 @@ struct FFollowPathState : public FMoverDataStructBase
 		const FFollowPathState* FromState = static_cast<const FFollowPathState*>(&From);
 		const FFollowPathState* ToState = static_cast<const FFollowPathState*>(&To);
 
-		BaseLocation = ToState->BaseLocation;
+		const FFollowPathState* BaseLocationState = (ToState->bHasBaseLocation || !FromState->bHasBaseLocation) ? ToState : FromState;
+		BaseLocation = BaseLocationState->BaseLocation;
+		bHasBaseLocation = BaseLocationState->bHasBaseLocation;
+		BaseLocationAge = ToState->BaseLocationAge;
 		CurrentPathPos = FMath::Lerp(FromState->CurrentPathPos, ToState->CurrentPathPos, Pct);
 		CurrentDirectionMod = ToState->CurrentDirectionMod;
 	}
@@ -6,6 +6,9 @@
 #include "MovementMode.h"
 #include "Components/InterpToMovementComponent.h"
 #include "MoverTypes.h"
+#include "MoverDataStructPool.h"
+#include "HAL/CriticalSection.h"
+#include "MovementBases/BakedCurveFloat.h"
 
 #include "FollowSplineMode.generated.h"
 
@@ -44,6 +47,70 @@ public:
 	ESplineOffsetUnit OffsetUnit = ESplineOffsetUnit::Percentage;
 };
 
+/**
+ * Range of the control spline a FollowSplineMode travels, derived from its offsets and duration settings
+ */
+struct FFollowSplineRange
+{
+	float StartOffsetSeconds = 0.0f;	// Spline time where following starts
+	float EndOffsetSeconds = 0.0f;		// Spline time where following ends
+	float FollowDuration = 0.0f;		// Spline time between start and end
+	float CycleDuration = 0.0f;			// Seconds a mover takes to travel from start to end, after any custom duration override
+};
+
+/**
+ * Everything a FFollowSplineRange is derived from. Cheap to gather and compare, so the range only has to be recomputed
+ * (with its potentially iterative distance-to-time spline searches) when one of these changes.
+ */
+struct FFollowSplineRangeStamp
+{
+	const USplineComponent* Spline = nullptr;
+	uint32 SplineVersion = 0;
+	float SplineDuration = 0.0f;
+	FSplineOffsetRangeInput StartOffset;
+	FSplineOffsetRangeInput EndOffset;
+	float CustomDurationSecondsOverride = 0.0f;
+
+	bool operator==(const FFollowSplineRangeStamp& Other) const
+	{
+		return Spline == Other.Spline
+			&& SplineVersion == Other.SplineVersion
+			&& SplineDuration == Other.SplineDuration
+			&& StartOffset.Value == Other.StartOffset.Value && StartOffset.OffsetUnit == Other.StartOffset.OffsetUnit
+			&& EndOffset.Value == Other.EndOffset.Value && EndOffset.OffsetUnit == Other.EndOffset.OffsetUnit
+			&& CustomDurationSecondsOverride == Other.CustomDurationSecondsOverride;
+	}
+};
+
+/**
+ * Control spline sampled at uniform time intervals, in the spline component's local space so it stays valid while the
+ * component moves. Evaluation is a table interpolation instead of a spline (and reparameterization) query.
+ */
+struct MOVEREXAMPLES_API FFollowSplineBakedTable
+{
+	TArray<FVector> Locations;
+	TArray<FQuat> Rotations;
+	TArray<FVector> Tangents;
+
+	float SplineDuration = 0.0f;		// Spline time covered by the table, starting at 0
+	float InvSampleInterval = 0.0f;		// Converts spline time to a (fractional) sample index
+	float MaxError = 0.0f;				// Largest location error measured between samples while baking
+
+	// What the table was baked from, to detect when it needs rebaking
+	TWeakObjectPtr<const USplineComponent> SourceSpline;
+	uint32 SourceSplineVersion = 0;
+	bool bSourceConstantVelocity = false;
+	float SourceTolerance = 0.0f;
+
+	// Bakes Spline, doubling the sample count until locations between samples are within Tolerance or MaxSamples is reached
+	void Build(const USplineComponent& Spline, bool bUseConstantVelocity, float Tolerance, int32 MaxSamples);
+
+	bool IsUpToDate(const USplineComponent& Spline, bool bUseConstantVelocity, float Tolerance) const;
+
+	// Samples the table at SplineTime, in the spline's local space. OutTangent is optional.
+	void Sample(float SplineTime, FVector& OutLocation, FQuat& OutRotation, FVector* OutTangent) const;
+};
+
 /**
  * FollowSplineMode: This mode performs movement of the associated actor, along a spline.
  * Default settings will provide a follow from start to end of the Spline. However, the start and end offsets could 
@@ -62,6 +129,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Mover|Spline")
 	void SetControlSpline(const AActor* SplineProviderActor, FSplineOffsetRangeInput Offset = FSplineOffsetRangeInput());
 
+	/**
+	 * Where a mover in SyncState will be Seconds from now (or ago, if negative), without simulating.
+	 * Const, but game thread only: the first query after the spline or range changes bakes and caches the followed range.
+	 */
+	FTransform EvaluateAtTime(const FMoverSyncState& SyncState, float Seconds) const;
+
 	// Follow Mode for Path Following
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Pathing)
 	EInterpToBehaviourType BehaviourType;
@@ -98,35 +171,64 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pathing|Interpolation")
 	TObjectPtr<UCurveFloat> InterpolationCurve;
 
+	// Sample the interpolation curve into an evenly spaced table shared by every mode using the same curve, instead of evaluating the curve every tick
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pathing|Baking")
+	bool bUseBakedInterpolationCurve = false;
+
+	// Sample the control spline into a lookup table when registered, instead of evaluating the spline every tick. Rebakes automatically when the spline changes.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pathing|Baking")
+	bool bUseBakedSpline = false;
+
+	// Maximum allowed distance between the baked table and the actual spline
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pathing|Baking", meta = (EditCondition = "bUseBakedSpline", ClampMin = "0.01", UIMin = "0.01", ForceUnits = "cm"))
+	float BakedSplineTolerance = 1.0f;
+
+	// Upper bound on baked samples, in case the tolerance can't be reached
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pathing|Baking", meta = (EditCondition = "bUseBakedSpline", ClampMin = "2", UIMin = "2"))
+	int32 MaxBakedSplineSamples = 4096;
+
 protected:
 	virtual void OnRegistered(const FName ModeName) override;
 
 	void ConfigureSplineData();
-	bool CanMove(float MeasuredSplineTime) const;
+	bool CanMove(const FFollowSplineRange& Range, float MappedSplineTime) const;
+
+	// Gets the followed range of the control spline, recomputing it only if the spline or offsets changed since last time.
+	// Returns false if there is no spline or the offsets are invalid.
+	bool ComputeFollowRange(FFollowSplineRange& OutRange) const;
 
-	FTransform GetTransformAtTime(float MeasuredSplineTime, const FRotator& DefaultOrientation);
+	// Advances an accumulated spline time by DeltaSeconds in closed form, wrapping for looping behaviors
+	float AdvanceSplineTime(const FFollowSplineRange& Range, float SplineTime, float DeltaSeconds) const;
 
-	float ApplyBehaviorType(float MeasuredSplineTime);
-	float ApplyFollowDirection(float MeasuredSplineTime);
+	// Samples the transform for an accumulated spline time. Returns false if the mover shouldn't move at that time.
+	bool SampleTransformAtSplineTime(const FFollowSplineRange& Range, float SplineTime, const FRotator& DefaultOrientation, FTransform& OutTransform, int32& OutDirectionMultiplier) const;
 
-	void UpdatePathState(FFollowSplineState& OutputPathState);
+	// Returns the baked table for the current control spline, rebaking first if the spline or bake settings changed
+	TSharedPtr<const FFollowSplineBakedTable, ESPMode::ThreadSafe> GetBakedSpline() const;
+
+	// Returns the shared table for the current interpolation curve, finding it again if the curve changed or was edited
+	TSharedPtr<const FBakedCurveFloat, ESPMode::ThreadSafe> GetBakedInterpolationCurve() const;
 
 protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Pathing)
 	TObjectPtr<USplineComponent> ControlSpline;
 
 private:
-	int32 StartReversedMultiplier = 1;
-	int32 FollowDirectionMultiplier = 1;
-	int32 OrientationMultiplier = 1;
-	
-	// Local State Variables
-	float CurrentSplineTime = 0.0f;
-	float StartOffsetSeconds = 0.0f;
-	float EndOffsetSeconds = 0.0f;
-	float FollowDuration = 0.0f;
-
-	bool bResetPingPong = false;
+	// Accumulated spline time a mover starts from, set alongside the control spline. Simulation only reads configuration;
+	// everything that changes while following lives in FFollowSplineState, so resimulation and parallel ticking are safe.
+	float InitialSplineTime = 0.0f;
+
+	FFollowSplineRangeStamp MakeRangeStamp() const;
+
+	// Derived from the control spline and configuration, never from simulation state. Guarded so parallel ticks can share it.
+	mutable FRWLock DerivedDataLock;
+	mutable TSharedPtr<const FFollowSplineBakedTable, ESPMode::ThreadSafe> BakedSpline;
+	mutable TSharedPtr<const FBakedCurveFloat, ESPMode::ThreadSafe> BakedInterpolationCurve;
+	mutable uint32 BakedInterpolationCurveGeneration = 0;
+	mutable FFollowSplineRange CachedRange;
+	mutable FFollowSplineRangeStamp CachedRangeStamp;
+	mutable bool bIsCachedRangeValid = false;
+	mutable bool bHasCachedRange = false;
 };
 
 
@@ -147,16 +249,10 @@ struct FFollowSplineState : public FMoverDataStructBase
 
 	virtual FMoverDataStructBase* Clone() const override;
 
-	virtual bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess) override
-	{
-		Super::NetSerialize(Ar, Map, bOutSuccess);
-
-		Ar << CurrentSplineTime;
-		Ar << CurrentDirectionMultiplier;
+	virtual bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess) override;
 
-		bOutSuccess = true;
-		return true;
-	}
+	// Replicated spline time resolution, in seconds. Fixed, since the server and clients must agree on it.
+	static constexpr float NetTimeQuantum = 0.001f;
 
 	virtual UScriptStruct* GetScriptStruct() const override { return StaticStruct(); }
 
@@ -172,7 +268,7 @@ struct FFollowSplineState : public FMoverDataStructBase
 	{
 		const FFollowSplineState* AuthoritySyncState = static_cast<const FFollowSplineState*>(&AuthorityState);
 
-		return !FMath::IsNearlyEqual(CurrentSplineTime, AuthoritySyncState->CurrentSplineTime) ||
+		return !FMath::IsNearlyEqual(CurrentSplineTime, AuthoritySyncState->CurrentSplineTime, NetTimeQuantum) ||
 			   (CurrentDirectionMultiplier != AuthoritySyncState->CurrentDirectionMultiplier);
 	}
 
@@ -0,0 +1,117 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/LockFreeFixedSizeAllocator.h"
+#include <atomic>
+
+/**
+ * Live and peak counts for one pooled data struct type. Each pool links its counters into a global list on first use,
+ * so they can be listed with "MoverExamples.Pools.Dump".
+ */
+struct MOVEREXAMPLES_API FMoverDataStructPoolCounters
+{
+	explicit FMoverDataStructPoolCounters(FString InName);
+
+	void OnAllocated();
+	void OnFreed() { NumLive.fetch_sub(1, std::memory_order_relaxed); }
+
+	int32 GetNumLive() const { return NumLive.load(std::memory_order_relaxed); }
+	int32 GetPeakLive() const { return PeakLive.load(std::memory_order_relaxed); }
+
+	const FString& GetName() const { return Name; }
+
+	static void ForEach(TFunctionRef<void(const FMoverDataStructPoolCounters& Counters)> Visitor);
+
+private:
+	FString Name;
+	std::atomic<int32> NumLive{ 0 };
+	std::atomic<int32> PeakLive{ 0 };
+	FMoverDataStructPoolCounters* Next = nullptr;
+};
+
+/**
+ * TMoverDataStructPool: thread-safe free list for one Mover data struct type. Mover clones sync and input state for
+ * every history frame, so keeping the freed blocks around takes that churn off the general heap. Blocks are never
+ * handed back to the heap.
+ *
+ * Only copies made with Create come from the pool. The struct itself keeps the global operator new/delete, since the
+ * struct ops (FMoverDataCollection::AddDataByType, NetSerialize) allocate instances with FMemory directly.
+ */
+template<typename StructType>
+class TMoverDataStructPool
+{
+	static_assert(alignof(StructType) <= 16, "Pooled blocks only have the default heap alignment");
+
+public:
+	// Pooled copy of Source, for use in Clone. Deleting it through any base pointer returns its block to the pool.
+	static StructType* Create(const StructType& Source);
+
+	static int32 GetNumLive() { return GetCounters().GetNumLive(); }
+	static int32 GetPeakLive() { return GetCounters().GetPeakLive(); }
+
+private:
+	template<typename> friend struct TMoverPooledDataStruct;
+
+	static void* Allocate()
+	{
+		GetCounters().OnAllocated();
+		return GetAllocator().Allocate();
+	}
+
+	static void Free(void* Ptr)
+	{
+		if (Ptr)
+		{
+			GetCounters().OnFreed();
+			GetAllocator().Free(Ptr);
+		}
+	}
+
+	// The allocator and counters are deliberately leaked. Pooled clones can still be deleted from other modules' histories
+	// after ours unloads or during static destruction at exit, and the counters stay linked into the ForEach list.
+	static TLockFreeFixedSizeAllocator<sizeof(StructType), PLATFORM_CACHE_LINE_SIZE>& GetAllocator()
+	{
+		static TLockFreeFixedSizeAllocator<sizeof(StructType), PLATFORM_CACHE_LINE_SIZE>* Allocator = new TLockFreeFixedSizeAllocator<sizeof(StructType), PLATFORM_CACHE_LINE_SIZE>();
+		return *Allocator;
+	}
+
+	static FMoverDataStructPoolCounters& GetCounters()
+	{
+		static FMoverDataStructPoolCounters* Counters = new FMoverDataStructPoolCounters(StructType::StaticStruct()->GetName());
+		return *Counters;
+	}
+};
+
+/**
+ * The dynamic type of a pooled copy. It adds nothing to StructType but its own operator new/delete, so instances made
+ * any other way are still deleted by the global operator delete and never touch the pool or its counters. Relies on
+ * StructType's virtual destructor (from FMoverDataStructBase) to pick the right delete.
+ */
+template<typename StructType>
+struct TMoverPooledDataStruct final : public StructType
+{
+	explicit TMoverPooledDataStruct(const StructType& Source)
+		: StructType(Source)
+	{
+	}
+
+	static void* operator new(size_t Size)
+	{
+		check(Size == sizeof(StructType));
+		return TMoverDataStructPool<StructType>::Allocate();
+	}
+
+	static void operator delete(void* Ptr)
+	{
+		TMoverDataStructPool<StructType>::Free(Ptr);
+	}
+};
+
+template<typename StructType>
+StructType* TMoverDataStructPool<StructType>::Create(const StructType& Source)
+{
+	static_assert(sizeof(TMoverPooledDataStruct<StructType>) == sizeof(StructType), "Pooled copies must fit the pooled block");
+	return new TMoverPooledDataStruct<StructType>(Source);
+}
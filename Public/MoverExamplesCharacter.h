@@ -10,6 +10,7 @@
 class UNavMoverComponent;// 处理AI导航移动的组件
 class UInputAction;// 增强输入系统动作
 class UCharacterMoverComponent;// Mover系统的核心角色移动组件
+class APlayerController;
 struct FInputActionValue; // 输入动作的值结构体
 
 /** 
@@ -47,6 +48,13 @@ public:
 	// 组件初始化后调用，用于获取Mover组件引用
 	virtual void PostInitializeComponents() override;
 
+	// 控制器变化（占有/取消占有/复制）时刷新缓存的PlayerController
+	virtual void NotifyControllerChanged() override;
+
+	// Looks up the mover, nav mover and spring arm components again. Not automatic: call it after adding or removing any of them at runtime.
+	UFUNCTION(BlueprintCallable, Category = MoverExamples)
+	void RefreshCachedComponents();
+
 	// 绑定输入功能，使用增强输入系统
 	// Called to bind functionality to input
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
@@ -121,6 +129,11 @@ public:
 	// Whether or not we author our movement inputs relative to whatever base we're standing on, or leave them in world space. Only applies if standing on a base of some sort.
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=MoverExamples)
 	bool bUseBaseRelativeMovement = true;
+
+	// Leave FMoverExampleAbilityInputs out of input commands while none of its buttons are pressed, so idle frames don't
+	// clone, send or compare it. Readers treat missing ability inputs as no buttons pressed.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=MoverExamples)
+	bool bOmitDefaultAbilityInputs = true;
 	
 	/**
 	 * If true, rotate the Character toward the direction the actor is moving
@@ -186,6 +199,9 @@ protected:
 	TObjectPtr<UNavMoverComponent> NavMoverComponent;
 	
 private:
+	// Resolved once rather than cast every input frame. See NotifyControllerChanged.
+	TWeakObjectPtr<APlayerController> CachedPlayerController;
+
 	/** 最后一次非零移动输入（用于维持朝向） */
 	FVector LastAffirmativeMoveInput = FVector::ZeroVector;	// Movement input (intent or velocity) the last time we had one that wasn't zero
 
@@ -0,0 +1,8 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Stats/Stats.h"
+
+// Use "stat MoverExamples" to view
+DECLARE_STATS_GROUP(TEXT("MoverExamples"), STATGROUP_MoverExamples, STATCAT_Advanced);